@@ -0,0 +1,63 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace tensorwrapper::backends {
+
+/** @brief The libraries which can perform the GEMM step of a contraction.
+ *
+ *  - eigen: Eigen's built-in matrix multiplication. Always available and
+ *           used for every floating-point type.
+ *  - cblas: A system CBLAS library (e.g., OpenBLAS or BLIS). Only available
+ *           if TensorWrapper was configured with ENABLE_CBLAS and only used
+ *           for float and double. Other types fall back to Eigen.
+ */
+enum class GemmBackend { eigen, cblas };
+
+/** @brief Was TensorWrapper built with CBLAS support?
+ *
+ *  @return True if the CBLAS backend can be selected and false otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+bool has_cblas() noexcept;
+
+/** @brief Returns the backend currently used for GEMMs.
+ *
+ *  The default is GemmBackend::cblas if has_cblas() is true and
+ *  GemmBackend::eigen otherwise.
+ *
+ *  @return The backend used for the GEMM step of subsequent contractions.
+ *
+ *  @throw None No throw guarantee.
+ */
+GemmBackend get_gemm_backend() noexcept;
+
+/** @brief Selects the backend used for the GEMM step of contractions.
+ *
+ *  The setting is process-wide and takes effect for contractions started
+ *  after this call returns. It is intended for comparing the backends, i.e.,
+ *  results should agree up to floating-point round-off.
+ *
+ *  @param[in] backend The backend to use for subsequent GEMMs.
+ *
+ *  @throw std::runtime_error if @p backend is GemmBackend::cblas and
+ *                            has_cblas() is false. Strong throw guarantee.
+ */
+void set_gemm_backend(GemmBackend backend);
+
+} // namespace tensorwrapper::backends
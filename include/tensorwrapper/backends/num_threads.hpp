@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace tensorwrapper::backends {
+
+/** @brief Returns the number of threads used to evaluate tensor expressions.
+ *
+ *  Permutations, element-wise operations, and scalar multiplications are
+ *  memory-bound and are spread over a pool of this many threads. Threading
+ *  is opt-in, since under MPI each rank already occupies a core: the default
+ *  is 1, unless the environment variable TENSORWRAPPER_NUM_THREADS holds a
+ *  positive integer, in which case that is the default.
+ *
+ *  @return The number of threads subsequent operations will use.
+ *
+ *  @throw None No throw guarantee.
+ */
+std::size_t get_num_threads() noexcept;
+
+/** @brief Sets the number of threads used to evaluate tensor expressions.
+ *
+ *  The setting is process-wide and takes effect for operations started after
+ *  this call returns. Operations already running finish on the threads they
+ *  started with. Setting @p n to 1 evaluates everything on the calling
+ *  thread.
+ *
+ *  @param[in] n The number of threads subsequent operations should use.
+ *
+ *  @throw std::runtime_error if @p n is 0. Strong throw guarantee.
+ */
+void set_num_threads(std::size_t n);
+
+} // namespace tensorwrapper::backends
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace tensorwrapper::backends {
+
+/** @brief Statistics about the cache of execution plans.
+ *
+ *  Working out how to execute a contraction (which modes are summed over,
+ *  which operands need permuting, the GEMM dimensions, etc.) only depends on
+ *  the labels, the extents of the operands, and the element type. The
+ *  backends cache these plans so that repeating the same expression (as
+ *  iterative methods do) only pays for the planning once. Element-wise
+ *  operations are cheap to plan and are not cached.
+ */
+struct PlanCacheStats {
+    /// Number of operations which reused a cached plan
+    std::size_t hits = 0;
+
+    /// Number of operations which had to make a new plan
+    std::size_t misses = 0;
+
+    /// Number of plans currently in the cache
+    std::size_t size = 0;
+};
+
+/** @brief Returns the statistics of the process-wide plan cache.
+ *
+ *  @return The counters accumulated since the last call to
+ *          clear_plan_cache(), or since the program started.
+ *
+ *  @throw None No throw guarantee.
+ */
+PlanCacheStats plan_cache_stats() noexcept;
+
+/** @brief Empties the process-wide plan cache and resets its counters.
+ *
+ *  @throw None No throw guarantee.
+ */
+void clear_plan_cache() noexcept;
+
+} // namespace tensorwrapper::backends
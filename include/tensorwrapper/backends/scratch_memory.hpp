@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace tensorwrapper::backends {
+
+/** @brief The most bytes of scratch memory a thread keeps between operations.
+ *
+ *  Backend operations take their temporaries (e.g., the packed panels of a
+ *  contraction, or a result which aliases an operand) from a per-thread
+ *  arena. After an operation the arena keeps its memory for the next one if
+ *  it holds at most this many bytes; otherwise the memory is freed. The
+ *  limit is zero, i.e., nothing is kept, until set_scratch_memory_limit() is
+ *  called.
+ *
+ *  @return The current limit, in bytes.
+ *
+ *  @throw None No throw guarantee.
+ */
+std::size_t scratch_memory_limit() noexcept;
+
+/** @brief Sets the most bytes of scratch memory a thread keeps between
+ *         operations.
+ *
+ *  The limit is process-wide and applies to each thread separately. Memory
+ *  already kept by a thread is checked against it when that thread's next
+ *  operation ends.
+ *
+ *  @param[in] nbytes The new limit. Zero frees the scratch memory after
+ *                    every operation.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_scratch_memory_limit(std::size_t nbytes) noexcept;
+
+/** @brief Frees the scratch memory kept by the calling thread.
+ *
+ *  @throw None No throw guarantee.
+ */
+void release_scratch_memory() noexcept;
+
+} // namespace tensorwrapper::backends
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <tensorwrapper/concepts/floating_point.hpp>
+#include <vector>
+
+namespace tensorwrapper::buffer {
+
+/** @brief How the memory for the elements of a Contiguous buffer is set up.
+ *
+ *  The elements of a Contiguous buffer live in a std::vector, so the memory
+ *  itself always comes from the default allocator. What the policy controls
+ *  is what happens to that memory between it being allocated and it being
+ *  touched for the first time, which is when the operating system decides
+ *  what kind of page backs it and on which NUMA node that page lives.
+ *
+ *  Both options are hints. They are ignored on platforms which do not
+ *  support them and for allocations smaller than min_bytes.
+ */
+struct AllocationPolicy {
+    /// Ask for transparent huge pages, reducing TLB misses for large tensors
+    bool huge_pages = false;
+
+    /// Spread the pages round-robin over the NUMA nodes of the machine,
+    /// rather than placing all of them on the node of the allocating thread
+    bool numa_interleave = false;
+
+    /// Allocations smaller than this many bytes are left alone
+    std::size_t min_bytes = std::size_t{1} << 21;
+
+    /// Policies are equal if all of their members are equal
+    bool operator==(const AllocationPolicy& rhs) const = default;
+};
+
+/** @brief The policy used when no policy is specified.
+ *
+ *  This is the policy used by the make_contiguous factories which do not
+ *  take a policy and by the operations of Contiguous when they need new
+ *  memory for their result. Initially it is a default constructed
+ *  AllocationPolicy, i.e., the memory is left alone.
+ *
+ *  @return A copy of the current default policy.
+ *
+ *  @throw None No throw guarantee.
+ */
+AllocationPolicy default_allocation_policy() noexcept;
+
+/** @brief Changes the policy used when no policy is specified.
+ *
+ *  Only affects allocations made after the call.
+ *
+ *  @param[in] policy The new default policy.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_default_allocation_policy(const AllocationPolicy& policy) noexcept;
+
+namespace detail_ {
+
+/** @brief Applies @p policy to the not yet touched memory
+ *         [@p data, @p data + @p nbytes).
+ *
+ *  @throw None No throw guarantee. Failing to apply a hint is not an error.
+ */
+void apply_allocation_policy(void* data, std::size_t nbytes,
+                             const AllocationPolicy& policy) noexcept;
+
+} // namespace detail_
+
+/** @brief Makes @p n elements set to @p value, following @p policy.
+ *
+ *  @tparam T The type of the elements. Must satisfy the FloatingPoint
+ *            concept.
+ *
+ *  @param[in] n The number of elements.
+ *  @param[in] value The value of each element.
+ *  @param[in] policy How to set up the memory. Defaults to
+ *                    default_allocation_policy().
+ *
+ *  @return The elements, ready to be moved into a Contiguous buffer.
+ *
+ *  @throw std::bad_alloc if the allocation fails. Strong throw guarantee.
+ */
+template<concepts::FloatingPoint T>
+std::vector<T> make_elements(
+  std::size_t n, T value,
+  const AllocationPolicy& policy = default_allocation_policy()) {
+    // Reserving allocates without touching the memory, so the hints are in
+    // place before the elements are written for the first time
+    std::vector<T> rv;
+    rv.reserve(n);
+    detail_::apply_allocation_policy(rv.data(), n * sizeof(T), policy);
+    rv.resize(n, value);
+    return rv;
+}
+
+} // namespace tensorwrapper::buffer
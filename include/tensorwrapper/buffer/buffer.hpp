@@ -15,10 +15,13 @@
  */
 
 #pragma once
+#include <tensorwrapper/buffer/allocation_policy.hpp>
 #include <tensorwrapper/buffer/buffer_base.hpp>
+#include <tensorwrapper/buffer/buffer_pool_stats.hpp>
 #include <tensorwrapper/buffer/contiguous.hpp>
 #include <tensorwrapper/buffer/local.hpp>
 #include <tensorwrapper/buffer/replicated.hpp>
+#include <tensorwrapper/buffer/typed_view.hpp>
 
 /** @brief Contains classes need to wrap instances of the various backends. */
 namespace tensorwrapper::buffer {}
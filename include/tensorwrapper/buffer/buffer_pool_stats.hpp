@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace tensorwrapper::buffer {
+
+/** @brief Statistics about the pool of recycled element buffers.
+ *
+ *  Iterative methods make (and free) tensors of the same sizes every
+ *  iteration. When a Contiguous buffer is destroyed, the memory holding its
+ *  elements can be kept in a process-wide pool, and the next operation
+ *  needing memory for the same number of elements of the same type takes it
+ *  from the pool instead of allocating. Once the pool is warm, iterations
+ *  no longer allocate memory for their results.
+ *
+ *  The pool is disabled (its limit is zero) until
+ *  set_buffer_pool_limit() is called.
+ */
+struct BufferPoolStats {
+    /// Number of requests served by a recycled buffer
+    std::size_t hits = 0;
+
+    /// Number of requests which had to allocate
+    std::size_t misses = 0;
+
+    /// Number of bytes currently held by the pool
+    std::size_t bytes_retained = 0;
+
+    /// Most bytes held by the pool at any one time
+    std::size_t high_water_mark = 0;
+};
+
+/** @brief Returns the statistics of the process-wide buffer pool.
+ *
+ *  @return The counters accumulated since the last call to
+ *          clear_buffer_pool(), or since the program started.
+ *
+ *  @throw None No throw guarantee.
+ */
+BufferPoolStats buffer_pool_stats() noexcept;
+
+/** @brief Frees the buffers held by the pool and resets its counters.
+ *
+ *  @throw None No throw guarantee.
+ */
+void clear_buffer_pool() noexcept;
+
+/** @brief The most bytes the pool will hold.
+ *
+ *  @throw None No throw guarantee.
+ */
+std::size_t buffer_pool_limit() noexcept;
+
+/** @brief Sets the most bytes the pool will hold.
+ *
+ *  If the pool holds more than @p nbytes, its oldest buffers are freed until
+ *  it does not. A limit of zero disables the pool.
+ *
+ *  @param[in] nbytes The new limit.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_buffer_pool_limit(std::size_t nbytes) noexcept;
+
+} // namespace tensorwrapper::buffer
@@ -15,18 +15,51 @@
  */
 
 #pragma once
+#include <tensorwrapper/buffer/allocation_policy.hpp>
 #include <tensorwrapper/buffer/replicated.hpp>
 #include <tensorwrapper/concepts/floating_point.hpp>
 #include <tensorwrapper/shape/smooth.hpp>
 #include <tensorwrapper/types/buffer_traits.hpp>
 #include <tensorwrapper/types/floating_point.hpp>
+#include <memory>
+#include <optional>
+#include <utility>
 
 namespace tensorwrapper::buffer {
+namespace detail_ {
+
+template<typename ReplicatedType>
+class SlicePIMPL;
+
+} // namespace detail_
 
 /** @brief A multidimensional (MD) contiguous buffer.
  *
  *  This class is a dense multidimensional buffer of contiguous floating-point
  *  values.
+ *
+ *  Copies of a Contiguous object share their elements (copy-on-write). The
+ *  elements are only copied when one of the objects sharing them is about to
+ *  modify them, e.g., by get_mutable_data or set_elem. Operations which
+ *  overwrite all of the elements of *this (e.g., addition_assignment) do not
+ *  copy them at all; the result is written to new memory instead.
+ *
+ *  Views returned by get_mutable_data (and everything built on it, e.g.,
+ *  get_raw_data, TypedView, or a NumPy array viewing a Tensor) can modify
+ *  the elements at any later time, which copy-on-write cannot see. Copies of
+ *  an object which has handed out such a view therefore get their own
+ *  elements right away.
+ *
+ *  Slices of a Contiguous object used in the DSL (see ReplicatedView) are
+ *  Contiguous objects which alias a strided block of the sliced object's
+ *  elements. Contractions read such a block where it is. Other operations
+ *  read a dense copy of it.
+ *
+ *  The same holds for elements provided with a physical layout which is not
+ *  dense and row-major (e.g., column-major or padded). They are stored as
+ *  provided, so views of them (get_mutable_data, get_immutable_data) are
+ *  laid out as layout() describes. Results of operations are always dense
+ *  and row-major. Reading *this never changes how its elements are stored.
  */
 class Contiguous : public Replicated {
 private:
@@ -113,16 +146,43 @@ public:
      */
     Contiguous(buffer_type buffer, shape_type shape);
 
-    /** @brief Initializes *this to a deep copy of @p other.
+    /** @brief Uses @p buffer, laid out as described by @p layout, as the
+     *         backing store.
+     *
+     *  This ctor allows elements which are not dense and row-major (e.g.,
+     *  column-major arrays from Fortran, or arrays with a padded leading
+     *  dimension) to be used without reordering them. The layout of *this is
+     *  @p layout until the elements are made dense (see the class
+     *  description).
      *
-     *  This ctor will initialize *this to be a deep copy of @p other.
+     *  @param[in] buffer The buffer to be used as the backing store.
+     *  @param[in] layout How the elements of *this are laid out in @p buffer.
+     *                    The shape must be a Smooth shape.
+     *
+     *  @throw std::invalid_argument if @p buffer is too small to hold the
+     *                               elements laid out as in @p layout, or if
+     *                               @p layout is dense and @p buffer holds
+     *                               more elements. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory for the
+     *                        internal state. Strong throw guarantee.
+     */
+    Contiguous(buffer_type buffer, const layout::Physical& layout);
+
+    /** @brief Initializes *this to a copy of @p other.
+     *
+     *  *this and @p other will share their elements until one of them is
+     *  modified, at which point the modified object gets its own copy of the
+     *  elements. Copying is therefore O(1) in the number of elements. The
+     *  exception is if @p other has handed out a view through which its
+     *  elements may be modified (see get_mutable_data). Then the elements
+     *  are copied right away.
      *
      *  @param[in] other The Contiguous to copy.
      *
      *  @throw std::bad_alloc if there is a problem allocating memory for the
      *                        internal state. Strong throw guarantee.
      */
-    Contiguous(const Contiguous& other) = default;
+    Contiguous(const Contiguous& other);
 
     /** @brief Move ctor.
      *
@@ -138,7 +198,9 @@ public:
 
     /** @brief Copy assignment.
      *
-     *  This operator will make *this a deep copy of @p other.
+     *  This operator will make *this a copy of @p other. Like the copy ctor,
+     *  the elements are shared until one of the objects is modified, unless
+     *  @p other has handed out a mutable view of them.
      *
      *  @param[in] other The Contiguous to copy.
      *
@@ -147,7 +209,7 @@ public:
      *  @throw std::bad_alloc if there is a problem allocating memory for the
      *                        internal state. Strong throw guarantee.
      */
-    Contiguous& operator=(const Contiguous& other) = default;
+    Contiguous& operator=(const Contiguous& other);
 
     /** @brief Move assignment.
      *
@@ -163,11 +225,15 @@ public:
      */
     Contiguous& operator=(Contiguous&& other) noexcept = default;
 
-    /** @brief Defaulted dtor.
+    /** @brief Releases the elements of *this.
+     *
+     *  If no other object shares the elements of *this, their memory is given
+     *  to the buffer pool (see set_buffer_pool_limit) so that a later
+     *  operation producing a result of the same size and type can reuse it.
      *
      *  @throw None No throw guarantee.
      */
-    ~Contiguous() override = default;
+    ~Contiguous() noexcept override;
 
     // -------------------------------------------------------------------------
     // -- State Accessors
@@ -198,16 +264,97 @@ public:
 
     /** @brief Returns a view of the data.
      *
+     *  If the elements of *this are shared with another Contiguous object
+     *  they are copied first, so that modifying them through the view does
+     *  not modify the other object. The elements are laid out as layout()
+     *  describes, i.e., dense and row-major unless *this was created with
+     *  another layout.
+     *
+     *  Since the view may be used to modify the elements at any later time,
+     *  copies of *this made after calling this method do not share the
+     *  elements of *this. This lasts until *this gets new elements, e.g., as
+     *  the result of an operation.
+     *
+     *  @throw std::bad_alloc if there is a problem copying the elements.
+     *                        Strong throw guarantee.
      */
     buffer_view get_mutable_data();
 
     /** @brief Returns a read-only view of the data.
      *
+     *  Like get_mutable_data, the elements are laid out as layout()
+     *  describes.
      */
     const_buffer_view get_immutable_data() const;
 
     value_type infinity_norm() const;
 
+    // -------------------------------------------------------------------------
+    // -- Block Operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Returns a dense copy of the elements [@p first_elem,
+     *         @p last_elem) of *this.
+     *
+     *  The block is copied a row (run of the last mode) at a time, with the
+     *  rows spread over the thread pool. This is much faster than copying the
+     *  block element by element via get_elem/set_elem.
+     *
+     *  @param[in] first_elem The index of the first element in the block.
+     *  @param[in] last_elem The index just past the last element in the
+     *                       block.
+     *
+     *  @return A Contiguous object holding a copy of the block.
+     *
+     *  @throw std::out_of_range if @p first_elem or @p last_elem do not
+     *                           describe a block of *this. Strong throw
+     *                           guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the copy.
+     *                        Strong throw guarantee.
+     */
+    Contiguous copy_block(const index_vector& first_elem,
+                          const index_vector& last_elem) const;
+
+    /** @brief Overwrites the block of *this starting at @p first_elem with
+     *         the elements of @p block.
+     *
+     *  The block of *this written to has the shape of @p block. Like
+     *  copy_block the elements are moved a row at a time, in parallel.
+     *
+     *  @param[in] first_elem The index of the first element of *this to
+     *                        overwrite.
+     *  @param[in] block The elements to write into *this.
+     *
+     *  @throw std::out_of_range if @p block does not fit in *this when placed
+     *                           at @p first_elem. Strong throw guarantee.
+     *  @throw std::runtime_error if the elements of @p block and *this are of
+     *                            different types. Strong throw guarantee.
+     *  @throw std::bad_alloc if the elements of *this are shared and there is
+     *                        a problem copying them. Strong throw guarantee.
+     */
+    void assign_block(const index_vector& first_elem, const Contiguous& block);
+
+    /** @brief Adds @p alpha times @p block to the block of *this starting at
+     *         @p first_elem.
+     *
+     *  Works like assign_block except that the elements of @p block, scaled
+     *  by @p alpha, are added to the current elements of *this.
+     *
+     *  @param[in] first_elem The index of the first element of *this to
+     *                        update.
+     *  @param[in] block The elements to add to *this.
+     *  @param[in] alpha The factor to scale @p block by. Defaults to 1.0.
+     *
+     *  @throw std::out_of_range if @p block does not fit in *this when placed
+     *                           at @p first_elem. Strong throw guarantee.
+     *  @throw std::runtime_error if the elements of @p block and *this are of
+     *                            different types. Strong throw guarantee.
+     *  @throw std::bad_alloc if the elements of *this are shared and there is
+     *                        a problem copying them. Strong throw guarantee.
+     */
+    void accumulate_block(const index_vector& first_elem,
+                          const Contiguous& block, double alpha = 1.0);
+
     // -------------------------------------------------------------------------
     // -- Utility Methods
     // -------------------------------------------------------------------------
@@ -215,10 +362,14 @@ public:
     /** @brief Compares two Contiguous objects for exact equality.
      *
      *  Two Contiguous objects are exactly equal if they have the same shape and
-     *  if all of their corresponding elements are bitwise identical.
-     *  In practice, the implementation stores a hash of the elements in the
-     *  tensor and compares the hashes for equality rather than checking each
-     *  element individually.
+     *  if all of their corresponding elements are bitwise identical. Plain
+     *  floating-point elements are compared directly (in parallel for large
+     *  buffers), stopping at the first difference. For other element types
+     *  the implementation stores a hash of the elements and compares the
+     *  hashes for equality rather than checking each element individually.
+     *  Elements are compared by value, not by how they are laid out, and
+     *  elements which are not dense and row-major are compared where they
+     *  are, one at a time.
      *
      *  @param[in] rhs The Contiguous to compare against.
      *
@@ -229,6 +380,9 @@ public:
     bool operator==(const my_type& rhs) const noexcept;
 
 protected:
+    template<typename ReplicatedType>
+    friend class detail_::SlicePIMPL;
+
     /// Makes a deep polymorphic copy of *this
     buffer_base_pointer clone_() const override;
 
@@ -246,12 +400,26 @@ protected:
       label_type this_labels, const_labeled_reference lhs,
       const_labeled_reference rhs) override;
 
+    /// Scales the product as it is formed, i.e., in the same pass
+    dsl_reference scaled_multiplication_assignment_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs) override;
+
+    /// Adds the product to the elements of *this without a temporary
+    dsl_reference multiplication_accumulation_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs) override;
+
     dsl_reference permute_assignment_(label_type this_labels,
                                       const_labeled_reference rhs) override;
 
     dsl_reference scalar_multiplication_(label_type this_labels, double scalar,
                                          const_labeled_reference rhs) override;
 
+    /// Combines all of the terms in one pass over the elements of *this
+    dsl_reference linear_combination_assignment_(
+      label_type this_labels, const linear_terms_type& terms) override;
+
     bool approximately_equal_(const_buffer_base_reference rhs,
                               double tol) const override;
 
@@ -303,9 +471,78 @@ private:
     /// Type for storing the hash of *this
     using hash_type = std::size_t;
 
+    /// Type of a pointer to the (possibly shared) elements of *this
+    using buffer_pointer = std::shared_ptr<buffer_type>;
+
+    /// Type of the strides of the modes of *this
+    using stride_vector = std::vector<size_type>;
+
+    /// Makes *this alias the elements of @p buffer which start @p offset
+    /// elements into it and are laid out with @p strides
+    Contiguous(buffer_pointer buffer, shape_type shape, size_type offset,
+               stride_vector strides);
+
+    /// Makes an object aliasing the elements [@p first_elem, @p last_elem) of
+    /// *this, without copying them
+    Contiguous alias_(const index_vector& first_elem,
+                      const index_vector& last_elem) const;
+
+    /// Does *this alias a strided block of elements (as opposed to owning
+    /// dense elements)?
+    bool is_strided_() const noexcept { return !m_strides_.empty(); }
+
+    /// The strides of the modes of *this within *m_buffer_
+    stride_vector strides_() const;
+
+    /// If *m_buffer_ holds just the elements of *this, laid out densely but
+    /// with the modes in another order, returns the labels and shape which
+    /// read it as a dense row-major tensor. @p labels label the modes of *this
+    std::optional<std::pair<label_type, shape_type>> as_dense_(
+      const label_type& labels) const;
+
+    /// Type of a pointer to elements which may not be modified
+    using const_buffer_pointer = std::shared_ptr<const buffer_type>;
+
+    /// Copies the elements of *this, in row-major order, into a new buffer
+    buffer_type gather_() const;
+
+    /// Read-only access to the elements of *this, as they are stored
+    const buffer_type& elements_() const;
+
+    /// The elements of *this as a dense row-major array. Dense elements are
+    /// returned without sharing their ownership, others are gathered first
+    const_buffer_pointer dense_elements_() const;
+
+    /// Are the elements of *this equal to those of @p rhs? Does not allocate,
+    /// so elements which are not dense are compared one at a time
+    bool strided_elements_equal_(const my_type& rhs) const noexcept;
+
+    /// Read/write access to the elements of *this, copying them first if they
+    /// are shared with another object
+    buffer_type& mutable_elements_();
+
+    /// Where to write a result which overwrites the elements of *this. Shared
+    /// elements are only copied if the operation @p reads_this
+    buffer_type& result_elements_(bool reads_this);
+
+    /// Is *this one of @p inputs?
+    template<typename... Args>
+    bool reads_this_(const Args&... inputs) const noexcept {
+        return ((&inputs == this) || ...);
+    }
+
     /// Logic for validating that an index is within the bounds of the shape
     void check_index_(const index_vector& index) const;
 
+    /// Validates that [@p first_elem, @p first_elem + @p extents) is a block
+    /// of *this
+    void check_block_(const index_vector& first_elem,
+                      const index_vector& extents) const;
+
+    /// Implements assign_block (@p alpha unset) and accumulate_block
+    void update_block_(const index_vector& first_elem, const Contiguous& block,
+                       std::optional<double> alpha);
+
     /// Converts a coordinate index to a linear (ordinal) index
     size_type coordinate_to_ordinal_(index_vector index) const;
 
@@ -339,10 +576,36 @@ private:
     /// How the hyper-rectangular array is shaped
     shape_type m_shape_;
 
-    /// The flat buffer holding the elements of *this
-    buffer_type m_buffer_;
+    /// The flat buffer holding the elements of *this, shared among copies
+    buffer_pointer m_buffer_;
+
+    /// Where the first element of *this is in *m_buffer_ (strided aliases)
+    size_type m_offset_ = 0;
+
+    /// The strides of the modes of *this in *m_buffer_, empty if dense
+    stride_vector m_strides_;
+
+    /// Was a view able to modify *m_buffer_ handed out? If so, copies of
+    /// *this get their own elements
+    bool m_mutable_view_out_ = false;
 };
 
+/** @brief Calls @p kernel with typed spans of the elements of @p buffer and
+ *         @p args.
+ *
+ *  The spans are the storage of the elements, laid out as the layout of each
+ *  buffer says (see Contiguous::get_mutable_data). They are only in logical
+ *  (row-major) order if layout().is_row_major() is true; otherwise kernels
+ *  must index them with layout().strides(), e.g., via make_typed_view, and
+ *  the spans may contain padding which is not an element.
+ *
+ *  @param[in] kernel The functor to call with the spans.
+ *  @param[in] buffer The buffer whose elements are given to @p kernel first.
+ *  @param[in] args The buffers whose elements are given to @p kernel next.
+ *
+ *  @return Whatever @p kernel returns.
+ */
+///@{
 template<typename KernelType, typename... Args>
 decltype(auto) visit_contiguous_buffer(KernelType&& kernel,
                                        buffer::Contiguous& buffer,
@@ -363,24 +626,43 @@ decltype(auto) visit_contiguous_buffer(KernelType&& kernel,
       std::forward<KernelType>(kernel), wtf_buffer,
       args.get_immutable_data()...);
 }
+///@}
 
+/** @brief Makes a Contiguous buffer with the shape @p shape whose elements
+ *         are all @p initial_value.
+ *
+ *  @param[in] shape The shape of the buffer.
+ *  @param[in] initial_value The value of each element.
+ *  @param[in] policy How to set up the memory for the elements. Defaults to
+ *                    default_allocation_policy().
+ */
 template<concepts::FloatingPoint T>
-Contiguous make_contiguous(const shape::ShapeBase& shape, T initial_value) {
+Contiguous make_contiguous(
+  const shape::ShapeBase& shape, T initial_value,
+  const AllocationPolicy& policy = default_allocation_policy()) {
     auto smooth_view = shape.as_smooth();
     using size_type  = typename decltype(smooth_view)::size_type;
     std::vector<size_type> extents(smooth_view.rank());
     for(size_type i = 0; i < smooth_view.rank(); ++i)
         extents[i] = smooth_view.extent(i);
     shape::Smooth smooth_shape(extents.begin(), extents.end());
-    std::vector<T> elements(smooth_view.size(), initial_value);
+    auto elements = make_elements(smooth_view.size(), initial_value, policy);
     return Contiguous(std::move(elements), std::move(smooth_shape));
 }
 
+/// Makes a zero-initialized Contiguous buffer with the shape @p shape
 template<concepts::FloatingPoint T>
 Contiguous make_contiguous(const shape::ShapeBase& shape) {
     return make_contiguous(shape, static_cast<T>(0));
 }
 
+/// Makes a zero-initialized Contiguous buffer, following @p policy
+template<concepts::FloatingPoint T>
+Contiguous make_contiguous(const shape::ShapeBase& shape,
+                           const AllocationPolicy& policy) {
+    return make_contiguous(shape, static_cast<T>(0), policy);
+}
+
 inline Contiguous& make_contiguous(buffer::BufferBase& buffer) {
     auto* pcontiguous = dynamic_cast<Contiguous*>(&buffer);
     if(pcontiguous == nullptr)
@@ -397,6 +679,13 @@ inline const Contiguous& make_contiguous(const buffer::BufferBase& buffer) {
     return *pcontiguous;
 }
 
+/** @brief Returns a typed span of the elements of @p buffer.
+ *
+ *  Like visit_contiguous_buffer, the span is the storage of the elements,
+ *  which is only in logical (row-major) order if the layout of @p buffer is
+ *  row-major.
+ */
+///@{
 template<typename FloatType>
 std::span<FloatType> get_raw_data(buffer::BufferBase& buffer) {
     auto& contiguous_buffer = make_contiguous(buffer);
@@ -420,13 +709,19 @@ std::span<const FloatType> get_raw_data(const buffer::BufferBase& buffer) {
     const auto& contiguous_buffer = make_contiguous(buffer);
     return get_raw_data<FloatType>(contiguous_buffer);
 }
+///@}
 
 /** @brief Makes a new Contiguous buffer using @p buffer as a guide.
  *
  *  This function is used to create a new buffer using @p buffer as a type hint.
  *  More specifically, this function will create a default initialized
  *  Contiguous buffer whose shape is given by @p shape. The type of the elements
- *  is taken from the type of the elements in @p buffer.
+ *  is taken from the type of the elements in @p buffer. The memory for the
+ *  elements is recycled from the buffer pool (see set_buffer_pool_limit) if
+ *  possible, and is otherwise set up according to
+ *  default_allocation_policy(). Recycled memory can not follow a policy, so
+ *  it is not used when the default policy asks for huge pages or NUMA
+ *  interleaving.
  */
 Contiguous make_contiguous(const buffer::BufferBase& buffer,
                            const shape::ShapeBase& shape);
@@ -57,6 +57,12 @@ public:
     using typename common_base_type::slice_type;
     ///@}
 
+    /// Type of a read-only buffer labeled for use in the DSL
+    using labeled_const_type = typename BufferBase::labeled_const_type;
+
+    /// Type of the labels used in the DSL
+    using string_type = typename labeled_const_type::string_type;
+
     /// Type of the PIMPL
     using pimpl_type = detail_::ReplicatedViewPIMPL<ReplicatedType>;
 
@@ -154,6 +160,31 @@ public:
     /// No-throw dtor.
     ~ReplicatedView() noexcept;
 
+    /** @brief Labels the modes of the viewed elements for use in the DSL.
+     *
+     *  The labeled object is a Contiguous buffer which aliases the viewed
+     *  elements where they are, i.e., they are not copied. Contractions read
+     *  them in place, e.g., no block is copied by
+     *  `C("i,j") = A.slice({0, 0}, {no, nv})("i,a") * B("a,j")`. Other
+     *  operations copy the viewed elements into dense memory once.
+     *
+     *  The labeled object is made by each call and is owned by the returned
+     *  Labeled object (and its copies), i.e., it lives as long as the
+     *  expression it is used in. Until then it shares the elements of the
+     *  viewed buffer, so modifying the viewed buffer in the meantime copies
+     *  its elements. Afterwards the viewed buffer is again the sole owner of
+     *  its elements.
+     *
+     *  @param[in] labels The dummy indices for the modes of *this.
+     *
+     *  @return The viewed elements, labeled with @p labels.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL or if the viewed
+     *                            buffer is not a Contiguous buffer. Strong
+     *                            throw guarantee.
+     */
+    labeled_const_type operator()(string_type labels) const;
+
 protected:
     friend common_base_type;
     friend typename common_base_type::sliceable_base;
@@ -0,0 +1,264 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tensorwrapper/buffer/contiguous.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace tensorwrapper::buffer {
+
+/** @brief A typed, multidimensional view of the elements of a Contiguous.
+ *
+ *  Contiguous::get_elem and Contiguous::set_elem work with type-erased
+ *  elements and validate their index on every call. This makes them
+ *  convenient, but slow when every element of a buffer must be visited.
+ *  TypedView is the fast alternative. It holds a span of the elements, as
+ *  their actual type, and the strides of the modes. Elements are then
+ *  accessed with operator(), which does no bounds checking and does not
+ *  allocate, or visited in storage order with for_each. For dense,
+ *  row-major elements storage order is row-major order.
+ *
+ *  TypedView does not own the elements. It is invalidated by anything that
+ *  invalidates the span returned by get_raw_data (e.g., assigning to, or
+ *  destroying, the viewed buffer).
+ *
+ *  @tparam FloatType The type of the elements. Const-qualified for read-only
+ *                    views.
+ */
+template<typename FloatType>
+class TypedView {
+public:
+    /// Unqualified type of the elements
+    using value_type = std::remove_const_t<FloatType>;
+
+    /// Type of a reference to an element (const for read-only views)
+    using reference = FloatType&;
+
+    /// Type of the span holding the elements
+    using span_type = std::span<FloatType>;
+
+    /// Type used for offsets and extents
+    using size_type = typename Contiguous::size_type;
+
+    /// Type of a (multidimensional) index
+    using index_vector = typename Contiguous::index_vector;
+
+    /** @brief Creates a view of no elements.
+     *
+     *  @throw None No throw guarantee.
+     */
+    TypedView() noexcept = default;
+
+    /** @brief Views @p data as a row-major array with extents @p extents.
+     *
+     *  @param[in] data The elements to view.
+     *  @param[in] extents The extents of the modes of the array.
+     *
+     *  @throw std::invalid_argument if the size of @p data does not match the
+     *                               size implied by @p extents. Strong throw
+     *                               guarantee.
+     *  @throw std::bad_alloc if there is a problem storing the extents and
+     *                        strides. Strong throw guarantee.
+     */
+    TypedView(span_type data, index_vector extents) :
+      m_data_(data), m_extents_(std::move(extents)) {
+        m_strides_.resize(m_extents_.size());
+        size_type stride = 1;
+        for(auto mode = m_extents_.size(); mode-- > 0;) {
+            m_strides_[mode] = stride;
+            stride *= m_extents_[mode];
+        }
+        if(stride != m_data_.size())
+            throw std::invalid_argument(
+              "The number of elements does not match the extents.");
+    }
+
+    /** @brief Views @p data as an array with extents @p extents, whose modes
+     *         are laid out with strides @p strides.
+     *
+     *  This is how elements stored in a layout other than dense and
+     *  row-major (e.g., column-major or padded) are viewed.
+     *
+     *  @param[in] data The elements to view.
+     *  @param[in] extents The extents of the modes of the array.
+     *  @param[in] strides The number of elements between consecutive offsets
+     *                     along each mode.
+     *
+     *  @throw std::invalid_argument if @p strides is not the same length as
+     *                               @p extents or if the elements do not fit
+     *                               in @p data. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem storing the extents and
+     *                        strides. Strong throw guarantee.
+     */
+    TypedView(span_type data, index_vector extents, index_vector strides) :
+      m_data_(data),
+      m_extents_(std::move(extents)),
+      m_strides_(std::move(strides)) {
+        if(m_strides_.size() != m_extents_.size())
+            throw std::invalid_argument(
+              "The number of strides does not match the number of extents.");
+        size_type last = 0;
+        for(size_type mode = 0; mode < rank(); ++mode) {
+            if(m_extents_[mode] == 0) return;
+            last += (m_extents_[mode] - 1) * m_strides_[mode];
+        }
+        if(last >= m_data_.size())
+            throw std::invalid_argument(
+              "The elements do not fit in the provided data.");
+    }
+
+    /// The number of modes in *this
+    size_type rank() const noexcept { return m_extents_.size(); }
+
+    /// The number of elements along mode @p mode (no bounds checking)
+    size_type extent(size_type mode) const noexcept {
+        return m_extents_[mode];
+    }
+
+    /// The number of elements in *this
+    size_type size() const noexcept {
+        if(m_data_.empty()) return 0;
+        size_type rv = 1;
+        for(auto extent : m_extents_) rv *= extent;
+        return rv;
+    }
+
+    /// The storage of the elements of *this, laid out as the strides describe
+    span_type data() const noexcept { return m_data_; }
+
+    /** @brief Returns the element with offsets @p indices.
+     *
+     *  This is the fast way to get at single elements. It is the caller's
+     *  responsibility to provide exactly rank() indices, each of which is
+     *  less than the extent of its mode; neither is checked.
+     *
+     *  @param[in] indices The offsets of the element along each mode.
+     *
+     *  @return A reference to the requested element.
+     *
+     *  @throw None No throw guarantee.
+     */
+    template<std::integral... Indices>
+    reference operator()(Indices... indices) const noexcept {
+        size_type ordinal = 0;
+        size_type mode    = 0;
+        ((ordinal += static_cast<size_type>(indices) * m_strides_[mode++]),
+         ...);
+        return m_data_[ordinal];
+    }
+
+    /** @brief Calls @p fxn on each element of *this, in storage order.
+     *
+     *  The elements are visited in the order they are stored in, i.e., the
+     *  mode with the smallest stride varies fastest, so the memory is walked
+     *  (as close as the layout allows) sequentially. For dense, row-major
+     *  elements this is row-major order.
+     *
+     *  @p fxn is called as `fxn(index, element)` where `index` is a
+     *  `const index_vector&` holding the offsets of `element`, a reference
+     *  to the element. The index is updated in place between calls, so only
+     *  the index and the order of the modes are ever allocated.
+     *
+     *  @tparam FxnType The type of @p fxn.
+     *
+     *  @param[in] fxn The function to call on each element.
+     *
+     *  @throw ??? Throws if @p fxn throws. Same throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the index.
+     *                        Strong throw guarantee.
+     */
+    template<typename FxnType>
+    void for_each(FxnType&& fxn) const {
+        // The modes from the largest to the smallest stride
+        index_vector order(rank());
+        std::iota(order.begin(), order.end(), size_type{0});
+        std::stable_sort(order.begin(), order.end(), [this](auto a, auto b) {
+            return m_strides_[a] > m_strides_[b];
+        });
+
+        index_vector index(rank(), 0);
+        size_type ordinal = 0;
+        for(size_type n = 0, n_elements = size(); n < n_elements; ++n) {
+            fxn(std::as_const(index), m_data_[ordinal]);
+            for(auto i = rank(); i-- > 0;) {
+                const auto mode = order[i];
+                ordinal += m_strides_[mode];
+                if(++index[mode] < m_extents_[mode]) break;
+                ordinal -= m_extents_[mode] * m_strides_[mode];
+                index[mode] = 0;
+            }
+        }
+    }
+
+private:
+    /// The viewed elements
+    span_type m_data_;
+
+    /// The extents of the modes of *this
+    index_vector m_extents_;
+
+    /// The number of elements between consecutive offsets along each mode
+    index_vector m_strides_;
+};
+
+/** @brief Makes a typed, mutable view of the elements of @p buffer.
+ *
+ *  Like get_mutable_data this copies the elements of @p buffer first if they
+ *  are shared with another Contiguous object.
+ *
+ *  @tparam FloatType The type of the elements in @p buffer.
+ *
+ *  @param[in] buffer The buffer to view.
+ *
+ *  @return A view of the elements of @p buffer.
+ *
+ *  @throw std::runtime_error if the elements of @p buffer are not of type
+ *                            @p FloatType. Strong throw guarantee.
+ */
+template<typename FloatType>
+TypedView<FloatType> make_typed_view(Contiguous& buffer) {
+    const auto shape = buffer.shape();
+    typename Contiguous::index_vector extents(shape.rank());
+    for(std::size_t mode = 0; mode < extents.size(); ++mode)
+        extents[mode] = shape.extent(mode);
+    auto data = get_raw_data<FloatType>(buffer);
+    if(buffer.has_layout() && !buffer.layout().is_row_major())
+        return TypedView<FloatType>(data, std::move(extents),
+                                    buffer.layout().strides());
+    return TypedView<FloatType>(data, std::move(extents));
+}
+
+/// Makes a typed, read-only view of the elements of @p buffer
+template<typename FloatType>
+TypedView<const FloatType> make_typed_view(const Contiguous& buffer) {
+    const auto shape = buffer.shape();
+    typename Contiguous::index_vector extents(shape.rank());
+    for(std::size_t mode = 0; mode < extents.size(); ++mode)
+        extents[mode] = shape.extent(mode);
+    auto data = get_raw_data<FloatType>(buffer);
+    if(buffer.has_layout() && !buffer.layout().is_row_major())
+        return TypedView<const FloatType>(data, std::move(extents),
+                                          buffer.layout().strides());
+    return TypedView<const FloatType>(data, std::move(extents));
+}
+
+} // namespace tensorwrapper::buffer
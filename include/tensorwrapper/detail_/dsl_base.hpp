@@ -17,6 +17,8 @@
 #pragma once
 #include <tensorwrapper/detail_/polymorphic_base.hpp>
 #include <tensorwrapper/dsl/labeled.hpp>
+#include <utility>
+#include <vector>
 
 namespace tensorwrapper::detail_ {
 
@@ -67,6 +69,12 @@ public:
     /// Type of a read-only reference to a labeled_type object
     using const_labeled_reference = const labeled_const_type&;
 
+    /// Type of a term in a linear combination, i.e., a coefficient and object
+    using linear_term_type = std::pair<double, labeled_const_type>;
+
+    /// Type of the terms of a linear combination
+    using linear_terms_type = std::vector<linear_term_type>;
+
     /// Polymorphic no-throw defaulted dtor
     virtual ~DSLBase() noexcept = default;
 
@@ -89,11 +97,33 @@ public:
      *  @throw None No throw guarantee.
      */
     template<typename LabelType>
-    labeled_type operator()(LabelType&& labels) {
+    labeled_type operator()(LabelType&& labels) & {
         label_type this_labels(std::forward<LabelType>(labels));
         return labeled_type(downcast_(), std::move(this_labels));
     }
 
+    /** @brief Associates labels with the modes of an expiring *this.
+     *
+     *  @tparam LabelType The type of @p labels. Assumed to be explicitly
+     *                    convertible to label_type.
+     *
+     *  This method is the same as the mutable version except that the result
+     *  is marked as expiring, e.g., for `std::move(A)("i,j")`. When evaluating
+     *  an expression, the parser is then free to reuse the state of *this for
+     *  the result instead of allocating new state.
+     *
+     *  @param[in] labels The labels to associate with *this.
+     *
+     *  @return A DSL term pairing *this with @p labels.
+     *
+     *  @throw None No throw guarantee.
+     */
+    template<typename LabelType>
+    labeled_type operator()(LabelType&& labels) && {
+        label_type this_labels(std::forward<LabelType>(labels));
+        return labeled_type(std::move(downcast_()), std::move(this_labels));
+    }
+
     /** @brief Associates labels with the modes of *this.
      *
      *  @tparam LabelType The type of @p labels. Assumed to be explicitly
@@ -109,7 +139,7 @@ public:
      *  @throw None No throw guarantee.
      */
     template<typename LabelType>
-    labeled_const_type operator()(LabelType&& labels) const {
+    labeled_const_type operator()(LabelType&& labels) const& {
         label_type this_labels(std::forward<LabelType>(labels));
         return labeled_const_type(downcast_(), std::move(this_labels));
     }
@@ -178,6 +208,82 @@ public:
                                             const_labeled_reference lhs,
                                             const_labeled_reference rhs);
 
+    /** @brief Set this to the result of @p alpha * @p lhs * @p rhs.
+     *
+     *  This overload folds a scalar factor into the product, e.g.,
+     *  `C = 2.0 * A * B`. Derived classes can override it to apply @p alpha
+     *  while the product is formed (e.g., the alpha of a GEMM); the default
+     *  forms the product and then scales it.
+     *
+     *  @param[in] this_labels The labels to associate with the modes of *this.
+     *  @param[in] alpha The factor to scale the product by.
+     *  @param[in] lhs The first object of the product.
+     *  @param[in] rhs The second object of the product.
+     *
+     *  @return *this after assigning @p alpha times the product of @p lhs and
+     *          @p rhs to *this.
+     *
+     *  @throws ??? Throws if the derived class's implementation throws. Same
+     *              throw guarantee.
+     */
+    template<typename LabelType>
+    dsl_reference multiplication_assignment(LabelType&& this_labels,
+                                            double alpha,
+                                            const_labeled_reference lhs,
+                                            const_labeled_reference rhs);
+
+    /** @brief Adds the result of @p lhs * @p rhs to *this.
+     *
+     *  This method is the accumulating counterpart of
+     *  multiplication_assignment, i.e., it implements `C += A * B`. Unlike
+     *  multiplication_assignment, the product is added to the current state
+     *  of *this, so *this must already be compatible with the product.
+     *  Derived classes can override it to accumulate directly into *this
+     *  (e.g., a GEMM with beta equal to 1); the default computes the product
+     *  into a temporary and then adds it to *this.
+     *
+     *  @param[in] this_labels The labels to associate with the modes of *this.
+     *  @param[in] lhs The first object of the product.
+     *  @param[in] rhs The second object of the product.
+     *
+     *  @return *this after adding the product of @p lhs and @p rhs to it.
+     *
+     *  @throw std::runtime_error if @p this_labels does not contain the same
+     *                            number of indices as *this has modes. Strong
+     *                            throw guarantee.
+     *  @throws ??? Throws if the derived class's implementation throws. Same
+     *              throw guarantee.
+     */
+    template<typename LabelType>
+    dsl_reference multiplication_accumulation(LabelType&& this_labels,
+                                              const_labeled_reference lhs,
+                                              const_labeled_reference rhs);
+
+    /** @brief Adds @p alpha times the result of @p lhs * @p rhs to *this.
+     *
+     *  Same as the overload without @p alpha, except that the product is
+     *  scaled by @p alpha first, e.g., `C -= A * B` is an @p alpha of -1.
+     *
+     *  @param[in] this_labels The labels to associate with the modes of *this.
+     *  @param[in] alpha The factor to scale the product by.
+     *  @param[in] lhs The first object of the product.
+     *  @param[in] rhs The second object of the product.
+     *
+     *  @return *this after adding @p alpha times the product of @p lhs and
+     *          @p rhs to it.
+     *
+     *  @throw std::runtime_error if @p this_labels does not contain the same
+     *                            number of indices as *this has modes. Strong
+     *                            throw guarantee.
+     *  @throws ??? Throws if the derived class's implementation throws. Same
+     *              throw guarantee.
+     */
+    template<typename LabelType>
+    dsl_reference multiplication_accumulation(LabelType&& this_labels,
+                                              double alpha,
+                                              const_labeled_reference lhs,
+                                              const_labeled_reference rhs);
+
     /** @brief Sets *this to a permutation of @p rhs.
      *
      *  `rhs.labels()` are the dummy indices associated with the modes of the
@@ -225,6 +331,31 @@ public:
                                         ScalarType&& scalar,
                                         const_labeled_reference rhs);
 
+    /** @brief Sets *this to a linear combination of objects.
+     *
+     *  Each term of @p terms is a coefficient paired with a labeled object.
+     *  This method sets *this to the sum of the coefficients times the
+     *  corresponding objects, permuting each object to the order of
+     *  @p this_labels. Expressions like `A + B - 2.0 * C` can be evaluated
+     *  this way in a single pass instead of one pass (and one temporary) per
+     *  operation.
+     *
+     *  @param[in] this_labels The labels to associate with the modes of *this.
+     *  @param[in] terms The coefficients and objects to combine.
+     *
+     *  @return *this after assigning the linear combination to it.
+     *
+     *  @throw std::runtime_error if @p terms is empty. Strong throw guarantee.
+     *  @throw std::runtime_error if the labels of a term are not a
+     *                            permutation of @p this_labels. Strong throw
+     *                            guarantee.
+     *  @throw ??? Throws if the derived class's implementation throws. Same
+     *              throw guarantee.
+     */
+    template<typename LabelType>
+    dsl_reference linear_combination_assignment(
+      LabelType&& this_labels, const linear_terms_type& terms);
+
 protected:
     /// Derived class should overwrite to implement addition_assignment
     virtual dsl_reference addition_assignment_(label_type this_labels,
@@ -247,6 +378,18 @@ protected:
         throw std::runtime_error("Multiplication assignment NYI");
     }
 
+    /// Derived class may overwrite to scale the product as it is formed. The
+    /// default forms the product and then scales it.
+    virtual dsl_reference scaled_multiplication_assignment_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs);
+
+    /// Derived class may overwrite to implement multiplication_accumulation
+    /// without a temporary. The default adds the product to *this.
+    virtual dsl_reference multiplication_accumulation_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs);
+
     /// Derived class should overwrite to implement permute_assignment
     virtual dsl_reference permute_assignment_(label_type this_labels,
                                               const_labeled_reference rhs) {
@@ -260,6 +403,11 @@ protected:
         throw std::runtime_error("Scalar multiplication NYI");
     }
 
+    /// Derived class may overwrite to implement linear_combination_assignment
+    /// in one pass. The default evaluates it pairwise.
+    virtual dsl_reference linear_combination_assignment_(
+      label_type this_labels, const linear_terms_type& terms);
+
 private:
     /// Checks that the dummy indices on an object are consistent with its rank
     void assert_indices_match_rank_(const_labeled_reference other) const {
@@ -72,6 +72,50 @@ typename DSL_BASE::dsl_reference DSL_BASE::multiplication_assignment(
     return multiplication_assignment_(std::move(result_labels), lhs, rhs);
 }
 
+TPARAMS
+template<typename LabelType>
+typename DSL_BASE::dsl_reference DSL_BASE::multiplication_assignment(
+  LabelType&& this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    assert_indices_match_rank_(lhs);
+    assert_indices_match_rank_(rhs);
+
+    label_type result_labels(std::forward<LabelType>(this_labels));
+    auto lr_labels = lhs.labels().concatenation(rhs.labels());
+    assert_is_subset_(result_labels, lr_labels);
+
+    return scaled_multiplication_assignment_(std::move(result_labels), alpha,
+                                             lhs, rhs);
+}
+
+TPARAMS
+template<typename LabelType>
+typename DSL_BASE::dsl_reference DSL_BASE::multiplication_accumulation(
+  LabelType&& this_labels, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    return multiplication_accumulation(std::forward<LabelType>(this_labels),
+                                       1.0, lhs, rhs);
+}
+
+TPARAMS
+template<typename LabelType>
+typename DSL_BASE::dsl_reference DSL_BASE::multiplication_accumulation(
+  LabelType&& this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    assert_indices_match_rank_(lhs);
+    assert_indices_match_rank_(rhs);
+
+    label_type result_labels(std::forward<LabelType>(this_labels));
+    const auto& result = downcast_();
+    assert_indices_match_rank_(result(result_labels));
+
+    auto lr_labels = lhs.labels().concatenation(rhs.labels());
+    assert_is_subset_(result_labels, lr_labels);
+
+    return multiplication_accumulation_(std::move(result_labels), alpha, lhs,
+                                        rhs);
+}
+
 TPARAMS
 template<typename LabelType>
 typename DSL_BASE::dsl_reference DSL_BASE::permute_assignment(
@@ -96,6 +140,101 @@ typename DSL_BASE::dsl_reference DSL_BASE::scalar_multiplication(
     return scalar_multiplication_(std::move(lhs_labels), scalar, rhs);
 }
 
+TPARAMS
+template<typename LabelType>
+typename DSL_BASE::dsl_reference DSL_BASE::linear_combination_assignment(
+  LabelType&& this_labels, const linear_terms_type& terms) {
+    if(terms.empty())
+        throw std::runtime_error("Linear combination must have a term");
+
+    label_type result_labels(std::forward<LabelType>(this_labels));
+    for(const auto& [coefficient, term] : terms) {
+        assert_indices_match_rank_(term);
+        assert_is_permutation_(result_labels, term.labels());
+    }
+
+    return linear_combination_assignment_(std::move(result_labels), terms);
+}
+
+TPARAMS
+typename DSL_BASE::dsl_reference DSL_BASE::linear_combination_assignment_(
+  label_type this_labels, const linear_terms_type& terms) {
+    auto& result = downcast_();
+
+    // Later terms are read after the first term overwrites *this, so terms
+    // which are *this read a copy of it instead
+    decltype(result.clone()) presult_copy;
+    linear_terms_type safe_terms;
+    safe_terms.reserve(terms.size());
+    for(std::size_t i = 0; i < terms.size(); ++i) {
+        const auto& [c, term] = terms[i];
+        if(i == 0 || &term.object() != &result) {
+            safe_terms.push_back(terms[i]);
+            continue;
+        }
+        if(!presult_copy) presult_copy = result.clone();
+        safe_terms.emplace_back(c, std::as_const(*presult_copy)(term.labels()));
+    }
+
+    const auto& [c0, term0] = safe_terms.front();
+    if(c0 == 1.0)
+        result.permute_assignment(this_labels, term0);
+    else
+        result.scalar_multiplication(this_labels, c0, term0);
+
+    // Remaining terms are scaled (if needed) and then added or subtracted
+    for(std::size_t i = 1; i < safe_terms.size(); ++i) {
+        const auto& [c, term] = safe_terms[i];
+        const auto abs_c      = c < 0.0 ? -c : c;
+
+        auto pscaled = result.clone();
+        if(abs_c != 1.0)
+            pscaled->scalar_multiplication(this_labels, abs_c, term);
+        else
+            pscaled->permute_assignment(this_labels, term);
+
+        auto pold  = result.clone();
+        auto lold  = (*pold)(this_labels);
+        auto lterm = (*pscaled)(this_labels);
+        if(c < 0.0)
+            result.subtraction_assignment(this_labels, lold, lterm);
+        else
+            result.addition_assignment(this_labels, lold, lterm);
+    }
+    return result;
+}
+
+TPARAMS
+typename DSL_BASE::dsl_reference DSL_BASE::scaled_multiplication_assignment_(
+  label_type this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    auto& result = downcast_();
+    multiplication_assignment_(this_labels, lhs, rhs);
+    if(alpha == 1.0) return result;
+
+    // N.b. *this is the only term, so derived classes can scale it in place
+    const auto& cresult = result;
+    linear_terms_type terms{{alpha, cresult(this_labels)}};
+    return result.linear_combination_assignment(this_labels, terms);
+}
+
+TPARAMS
+typename DSL_BASE::dsl_reference DSL_BASE::multiplication_accumulation_(
+  label_type this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    auto& result = downcast_();
+
+    auto pproduct = result.clone();
+    pproduct->multiplication_assignment(this_labels, lhs, rhs);
+
+    // N.b. *this is a term, so derived classes can accumulate in place
+    const auto& cresult  = result;
+    const auto& cproduct = *pproduct;
+    linear_terms_type terms{{1.0, cresult(this_labels)},
+                            {alpha, cproduct(this_labels)}};
+    return result.linear_combination_assignment(this_labels, terms);
+}
+
 #undef DSL_BASE
 #undef TPARAMS
 
@@ -17,6 +17,7 @@
 
 #pragma once
 #include <iostream>
+#include <memory>
 #include <tensorwrapper/dsl/dummy_indices.hpp>
 #include <tensorwrapper/dsl/pairwise_parser.hpp>
 #include <type_traits>
@@ -110,6 +111,9 @@ public:
      *  to LabelType. We solve this by using this ctor to explicitly convert
      *  @p labels into LabelType before the base class does its TMP.
      *
+     *  If @p object is an rvalue, *this is marked as expiring (see
+     *  is_expiring).
+     *
      *  @param[in] object The object the labels apply to.
      *  @param[in] labels The annotations for the tensor.
      *
@@ -118,7 +122,32 @@ public:
      */
     template<typename ObjectType2, typename LabelType>
     Labeled(ObjectType2&& object, LabelType&& labels) :
-      m_object_(&object), m_labels_(std::forward<LabelType>(labels)) {}
+      m_object_(&object),
+      m_labels_(std::forward<LabelType>(labels)),
+      m_expiring_(!std::is_lvalue_reference_v<ObjectType2>) {}
+
+    /** @brief Associates a set of dummy indices with an object which *this
+     *         keeps alive.
+     *
+     *  This is for objects which are only made to take part in an
+     *  expression, e.g., a buffer aliasing the elements of a view. Copies of
+     *  *this share ownership of the object, so it lives as long as the
+     *  expression does.
+     *
+     *  @tparam LabelType The type of @p labels. Assumed to be implicitly
+     *                    convertible to either StringType or label_type.
+     *
+     *  @param[in] pobject The object the labels apply to.
+     *  @param[in] labels The annotations for the object.
+     *
+     *  @throw std::bad_alloc if converting @p labels to LabelType throws.
+     *                        Strong throw guarantee.
+     */
+    template<typename LabelType>
+    Labeled(std::shared_ptr<ObjectType> pobject, LabelType&& labels) :
+      m_object_(pobject.get()),
+      m_labels_(std::forward<LabelType>(labels)),
+      m_owner_(std::move(pobject)) {}
 
     /** @brief Allows implicit conversion from mutable objects to const objects
      *
@@ -223,6 +252,62 @@ public:
         return assign_(std::forward<TermType>(other));
     }
 
+    /** @brief Adds a DSL term to *this.
+     *
+     *  @tparam TermType The type of the expression being added to *this.
+     *
+     *  Unlike `x = x + other`, *this is updated in place. In particular, for
+     *  a product of two objects, e.g., `C("i,j") += A("i,k") * B("k,j")`, the
+     *  product is accumulated directly into the object (a GEMM with a beta of
+     *  1) instead of being evaluated into a temporary first.
+     *
+     *  @param[in] other The object containing the AST to add to *this.
+     *
+     *  @return *this after adding @p other to it.
+     *
+     *  @throw ??? If the parser throws. Same throw guarantee.
+     */
+    template<typename TermType>
+    my_type& operator+=(TermType&& other) {
+        PairwiseParser p;
+        p.accumulate(*this, 1.0, std::forward<TermType>(other));
+        return *this;
+    }
+
+    /** @brief Subtracts a DSL term from *this.
+     *
+     *  @tparam TermType The type of the expression being subtracted.
+     *
+     *  This method is the same as operator+= except that @p other is
+     *  subtracted from *this.
+     *
+     *  @param[in] other The object containing the AST to subtract from *this.
+     *
+     *  @return *this after subtracting @p other from it.
+     *
+     *  @throw ??? If the parser throws. Same throw guarantee.
+     */
+    template<typename TermType>
+    my_type& operator-=(TermType&& other) {
+        PairwiseParser p;
+        p.accumulate(*this, -1.0, std::forward<TermType>(other));
+        return *this;
+    }
+
+    /** @brief Scales *this in place.
+     *
+     *  @param[in] scalar The value to multiply *this by.
+     *
+     *  @return *this after scaling it by @p scalar.
+     *
+     *  @throw ??? If the parser throws. Same throw guarantee.
+     */
+    my_type& operator*=(double scalar) {
+        PairwiseParser p;
+        p.scale(*this, scalar);
+        return *this;
+    }
+
     /** @brief Returns a (possibly) read-only reference to the object.
      *
      *  This method is used to access the object associated with the dummy
@@ -290,6 +375,22 @@ public:
      */
     bool has_object() const noexcept { return static_cast<bool>(m_object_); }
 
+    /** @brief Is the object *this aliases about to expire?
+     *
+     *  Labeled objects made from rvalues, e.g., `std::move(A)("i,j")`, are
+     *  expiring. The state of an expiring object may be reused (and thus
+     *  clobbered) when evaluating the expression it appears in. Only mutable
+     *  objects can be expiring.
+     *
+     *  @return True if *this aliases a mutable object that may be reused and
+     *          false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_expiring() const noexcept {
+        return !has_cv_object_v && m_expiring_;
+    }
+
     /** @brief Determines if *this is value equal to @p rhs.
      *
      *  Two Labeled objects are value equal if their labels compare value equal
@@ -353,6 +454,12 @@ private:
 
     /// The dummy indices associated with m_object_
     label_type m_labels_;
+
+    /// Was *this made from an rvalue?
+    bool m_expiring_ = false;
+
+    /// Keeps m_object_ alive if *this was given ownership of it
+    std::shared_ptr<ObjectType> m_owner_;
 };
 
 } // namespace tensorwrapper::dsl
@@ -17,7 +17,9 @@
 #pragma once
 #include <tensorwrapper/dsl/dsl_forward.hpp>
 #include <tensorwrapper/shape/shape_fwd.hpp>
+#include <type_traits>
 #include <utilities/dsl/dsl.hpp>
+#include <vector>
 
 namespace tensorwrapper::dsl {
 
@@ -30,28 +32,38 @@ namespace tensorwrapper::dsl {
  *  performant way to evaluate the AST, e.g., this prohibits detection of
  *  common intermediates across multiple equations.
  *
- *  @note The
- *        @code
- *        auto pA     = lhs.object().clone();
- *        auto pB     = lhs.object().clone();
- *        auto labels = lhs.labels();
- *        auto lA     = (*pA)(labels);
- *        auto lB     = (*pB)(labels);
- *        dispatch(lA, rhs.lhs());
- *        dispatch(lB, rhs.rhs());
- *        @endcode
- *        are repetitive, but we need to keep pA and pB alive which inhibits
- *        factorization.
+ *  The exception is the linear part of an expression. Sums, differences, and
+ *  scalar multiples, e.g., `A + B - 2.0 * C`, are evaluated by a single call
+ *  to linear_combination_assignment so that no temporaries are needed for the
+ *  intermediate sums. Products of two objects which appear in a linear
+ *  expression, e.g., the `2.0 * A * B` in `D + 2.0 * A * B`, are then
+ *  accumulated into the result with their scalar factors, i.e., like the
+ *  alpha and beta of a GEMM, rather than being evaluated into temporaries.
+ *
+ *  Labeled objects are never copied. When an operand of an operation is a
+ *  labeled object it is handed to the operation as is; temporaries are only
+ *  made for operands which are themselves expressions (and for operands which
+ *  are also the object being assigned to, but with different labels).
+ *
+ *  Objects which are expiring, e.g., `std::move(A)("i,j")`, may donate their
+ *  state to the result. If such an object has the same labels as the result,
+ *  the expression is evaluated in place into it and it is then moved into the
+ *  result, e.g., `B("i,j") = std::move(A)("i,j") + C("i,j")` evaluates
+ *  `A("i,j") = A("i,j") + C("i,j")` followed by `B = std::move(A)`.
  */
 class PairwiseParser {
 public:
     /** @brief Recursion end-point
      *
-     *  Ternary operations like `C = A + B` are ultimately evaluated by
-     *  assigning `A` and `B` to temporaries and then summing the temporaries.
-     *  The assignment to the temporary ensures that if `A` or `B` is itself a
-     *  term it gets evaluated down to an object before the addition happens.
-     *  The assignment calls this overload of dispatch.
+     *  This overload handles plain assignments, e.g., `A = B`. When an
+     *  operand of a ternary operation like `C = A * B` is itself an
+     *  expression, it is evaluated into a temporary before the operation
+     *  happens; that evaluation also ends up here.
+     *
+     *  If the labels of @p lhs are a subset of those of @p rhs, @p rhs is
+     *  permuted and/or traced into @p lhs, e.g., `C("i") = A("i,j,j")`.
+     *  Otherwise the labels of @p lhs are replaced by those of @p rhs, i.e.,
+     *  @p rhs is copied as is.
      *
      *  @param[in] lhs The object to assign @p rhs to.
      *  @param[in] rhs The "expression" that needs to be evaluated.
@@ -59,7 +71,14 @@ public:
      */
     template<typename LHSType, typename RHSType>
     void dispatch(LHSType&& lhs, const RHSType& rhs) {
-        if(lhs.labels().is_permutation(rhs.labels()))
+        if(steal_(lhs, rhs)) return;
+
+        // Nothing to do, e.g., rhs is an expiring object steal_ is reusing
+        if(&lhs.object() == &rhs.object() && lhs.labels() == rhs.labels())
+            return;
+
+        // N.b. this covers permutations and traces
+        if(lhs.labels().difference(rhs.labels()).size() == 0)
             lhs.object().permute_assignment(lhs.labels(), rhs);
         else { // User just wants us to assign RHS to LHS
             lhs.labels() = rhs.labels();
@@ -68,6 +87,12 @@ public:
     }
 
     /** @brief Handles adding two expressions together.
+     *
+     *  Sums, differences, and scalar multiples are linear in their operands.
+     *  The entire linear part of @p rhs (not just `lhs + rhs`) is collected
+     *  into a list of terms which are then combined in one pass by
+     *  linear_combination_assignment. Only terms which are not linear (e.g.,
+     *  products of tensors) are evaluated into temporaries first.
      *
      *  @tparam LHSType The type to assign the sum of @p lhs and @p rhs to.
      *  @tparam T The type of the expression on the left side of the "+" sign.
@@ -81,17 +106,12 @@ public:
      */
     template<typename LHSType, typename T, typename U>
     void dispatch(LHSType&& lhs, const utilities::dsl::Add<T, U>& rhs) {
-        auto pA     = lhs.object().clone();
-        auto pB     = lhs.object().clone();
-        auto labels = lhs.labels();
-        auto lA     = (*pA)(labels);
-        auto lB     = (*pB)(labels);
-        dispatch(lA, rhs.lhs());
-        dispatch(lB, rhs.rhs());
-        lhs.object().addition_assignment(labels, lA, lB);
+        linear_dispatch_(lhs, rhs);
     }
 
     /** @brief Handles subtracting two expressions together.
+     *
+     *  Like addition, this is evaluated with linear_combination_assignment.
      *
      *  @tparam LHSType The type of the object the expression will be evaluated
      *                  into.
@@ -106,17 +126,14 @@ public:
      */
     template<typename LHSType, typename T, typename U>
     void dispatch(LHSType&& lhs, const utilities::dsl::Subtract<T, U>& rhs) {
-        auto pA     = lhs.object().clone();
-        auto pB     = lhs.object().clone();
-        auto labels = lhs.labels();
-        auto lA     = (*pA)(labels);
-        auto lB     = (*pB)(labels);
-        dispatch(lA, rhs.lhs());
-        dispatch(lB, rhs.rhs());
-        lhs.object().subtraction_assignment(labels, lA, lB);
+        linear_dispatch_(lhs, rhs);
     }
 
     /** @brief Handles multiplying two expressions together.
+     *
+     *  Scalar factors of a product of two objects, e.g., the 2.0 in
+     *  `2.0 * A * B`, are handed to multiplication_assignment along with the
+     *  product so that they are applied while the product is formed.
      *
      *  @tparam LHSType The type of the object the expression will be evaluated
      *                  into.
@@ -134,27 +151,404 @@ public:
         constexpr bool t_is_float = std::is_floating_point_v<T>;
         constexpr bool u_is_float = std::is_floating_point_v<U>;
         static_assert(!(t_is_float && u_is_float), "Both can be float??");
-        if constexpr(t_is_float) {
-            auto pA = lhs.object().clone();
-            auto lA = (*pA)(lhs.labels());
-            dispatch(lA, rhs.rhs());
+        if(steal_(lhs, rhs)) return;
+
+        if constexpr(t_is_float && is_labeled<U>::value) {
+            temporaries_type<LHSType> temporaries;
+            auto lA = operand_(lhs, rhs.rhs(), temporaries);
             lhs.object().scalar_multiplication(lhs.labels(), rhs.lhs(), lA);
-        } else if constexpr(u_is_float) {
-            auto pA = lhs.object().clone();
-            auto lA = (*pA)(lhs.labels());
-            dispatch(lA, rhs.lhs());
+        } else if constexpr(u_is_float && is_labeled<T>::value) {
+            temporaries_type<LHSType> temporaries;
+            auto lA = operand_(lhs, rhs.lhs(), temporaries);
             lhs.object().scalar_multiplication(lhs.labels(), rhs.rhs(), lA);
+        } else if constexpr(t_is_float || u_is_float) {
+            // Scalar multiple of an expression, which is linear in the terms
+            // of the expression
+            linear_dispatch_(lhs, rhs);
+        } else {
+            temporaries_type<LHSType> temporaries;
+            double alpha = 1.0;
+            auto lA      = operand_(lhs, rhs.lhs(), temporaries, alpha);
+            auto lB      = operand_(lhs, rhs.rhs(), temporaries, alpha);
+            lhs.object().multiplication_assignment(lhs.labels(), alpha, lA,
+                                                   lB);
+        }
+    }
+
+    /** @brief Adds @p c times the expression @p rhs to @p lhs.
+     *
+     *  This implements `lhs += rhs` (@p c equal to 1) and `lhs -= rhs` (@p c
+     *  equal to -1). If @p rhs is a product of two objects, the product is
+     *  accumulated directly into @p lhs by multiplication_accumulation, with
+     *  @p c and any scalar factors of the product as its alpha. Otherwise,
+     *  @p lhs becomes one of the terms of a linear combination with the
+     *  linear terms of @p rhs, which the object evaluates in place, and then
+     *  the products in @p rhs are accumulated into @p lhs.
+     *
+     *  @param[in] lhs The object to add @p rhs to.
+     *  @param[in] c What @p rhs is scaled by.
+     *  @param[in] rhs The expression to evaluate.
+     *
+     *  @throw std::runtime_error if there is a problem doing the operation.
+     *                            Strong throw guarantee.
+     */
+    template<typename LHSType, typename RHSType>
+    void accumulate(LHSType&& lhs, double c, const RHSType& rhs) {
+        temporaries_type<LHSType> temporaries;
+        if constexpr(is_product_v<RHSType>) {
+            double alpha = c;
+            auto lA      = operand_(lhs, rhs.lhs(), temporaries, alpha);
+            auto lB      = operand_(lhs, rhs.rhs(), temporaries, alpha);
+            lhs.object().multiplication_accumulation(lhs.labels(), alpha, lA,
+                                                     lB);
         } else {
-            auto pA     = rhs.lhs().object().clone();
-            auto pB     = rhs.rhs().object().clone();
-            auto labels = lhs.labels();
-            auto lA     = (*pA)(labels);
-            auto lB     = (*pB)(labels);
-            dispatch(lA, rhs.lhs());
-            dispatch(lB, rhs.rhs());
-            lhs.object().multiplication_assignment(labels, lA, lB);
+            using terms_type = typename object_type<LHSType>::linear_terms_type;
+
+            terms_type terms;
+            terms.emplace_back(1.0, lhs);
+            add_terms_(lhs, c, rhs, terms, temporaries);
+            if(!is_identity_(lhs, terms))
+                lhs.object().linear_combination_assignment(lhs.labels(), terms);
+
+            bool assigned = true;
+            add_products_(lhs, c, rhs, assigned, temporaries);
         }
     }
+
+    /** @brief Scales @p lhs by @p c in place.
+     *
+     *  @param[in] lhs The object to scale.
+     *  @param[in] c What to scale @p lhs by.
+     *
+     *  @throw std::runtime_error if there is a problem doing the operation.
+     *                            Strong throw guarantee.
+     */
+    template<typename LHSType>
+    void scale(LHSType&& lhs, double c) {
+        typename object_type<LHSType>::linear_terms_type terms;
+        terms.emplace_back(c, lhs);
+        lhs.object().linear_combination_assignment(lhs.labels(), terms);
+    }
+
+private:
+    /// Is T a labeled object (as opposed to an expression)?
+    template<typename T>
+    struct is_labeled : std::false_type {};
+
+    template<typename ObjectType, typename LabelType>
+    struct is_labeled<Labeled<ObjectType, LabelType>> : std::true_type {};
+
+    /// Is T a product of two objects (as opposed to a scalar multiple)?
+    template<typename T>
+    struct is_product : std::false_type {};
+
+    template<typename T, typename U>
+    struct is_product<utilities::dsl::Multiply<T, U>>
+      : std::bool_constant<!std::is_floating_point_v<T> &&
+                           !std::is_floating_point_v<U>> {};
+
+    template<typename T>
+    static constexpr bool is_product_v = is_product<T>::value;
+
+    /// Does the expression @p rhs read from the object assigned to by @p lhs?
+    template<typename LHSType, typename RHSType>
+    static bool references_(const LHSType& lhs, const RHSType& rhs) {
+        if constexpr(is_labeled<RHSType>::value)
+            return &rhs.object() == &lhs.object();
+        else if constexpr(std::is_floating_point_v<RHSType>)
+            return false;
+        else
+            return references_(lhs, rhs.lhs()) || references_(lhs, rhs.rhs());
+    }
+
+    /// How many times does the expression @p rhs read from @p pobject?
+    template<typename ObjectType, typename RHSType>
+    static std::size_t count_(const ObjectType* pobject, const RHSType& rhs) {
+        if constexpr(is_labeled<RHSType>::value)
+            return &rhs.object() == pobject;
+        else if constexpr(std::is_floating_point_v<RHSType>)
+            return 0;
+        else
+            return count_(pobject, rhs.lhs()) + count_(pobject, rhs.rhs());
+    }
+
+    /// Type of the object being assigned to by @p LHSType
+    template<typename LHSType>
+    using object_type = typename std::decay_t<LHSType>::object_type;
+
+    /** @brief Finds an expiring object which can hold the result of @p rhs.
+     *
+     *  Candidates are the expiring objects of the same (concrete) type as the
+     *  object assigned to by @p lhs, which have the same labels as @p lhs,
+     *  and which are terms of the linear part of @p rhs (or operands of @p rhs
+     *  if it is a product). Products inside of a linear expression are
+     *  evaluated after the linear terms, so their operands can not be
+     *  candidates. The candidate must be read exactly once, since any other
+     *  read would see the result instead. Nothing is stolen if @p rhs already
+     *  reads the object assigned to, e.g., if a donor was already found.
+     *
+     *  @return A pointer to the object to evaluate @p rhs into, or nullptr
+     *          if there is none.
+     */
+    template<typename LHSType, typename RHSType>
+    static object_type<LHSType>* donor_(const LHSType& lhs,
+                                        const RHSType& rhs) {
+        if(references_(lhs, rhs)) return nullptr;
+
+        object_type<LHSType>* pdonor = nullptr;
+        if constexpr(is_product_v<RHSType>) {
+            pdonor = linear_donor_(lhs, rhs.lhs());
+            if(pdonor == nullptr) pdonor = linear_donor_(lhs, rhs.rhs());
+        } else {
+            pdonor = linear_donor_(lhs, rhs);
+        }
+
+        if(pdonor != nullptr && count_(pdonor, rhs) != 1) return nullptr;
+        return pdonor;
+    }
+
+    /// Returns the first candidate donor in the linear part of @p rhs
+    template<typename LHSType, typename RHSType>
+    static object_type<LHSType>* linear_donor_(const LHSType& lhs,
+                                               const RHSType& rhs) {
+        using object_t = object_type<LHSType>;
+        if constexpr(is_labeled<RHSType>::value) {
+            // The donor is moved into the result, which would slice objects
+            // only known by their (abstract) base class
+            using rhs_object_t = typename RHSType::object_type;
+            constexpr bool is_same = std::is_same_v<rhs_object_t, object_t>;
+            if constexpr(is_same && !std::is_abstract_v<object_t>) {
+                if(!rhs.is_expiring() || rhs.labels() != lhs.labels())
+                    return nullptr;
+                // Expiring objects are mutable, the const is from rhs
+                return &const_cast<object_t&>(rhs.object());
+            }
+            return nullptr;
+        } else if constexpr(std::is_floating_point_v<RHSType> ||
+                            is_product_v<RHSType>) {
+            return nullptr;
+        } else {
+            auto pdonor = linear_donor_(lhs, rhs.lhs());
+            return pdonor != nullptr ? pdonor : linear_donor_(lhs, rhs.rhs());
+        }
+    }
+
+    /** @brief Evaluates @p rhs into an expiring object and moves it to @p lhs
+     *
+     *  @return True if @p rhs was evaluated into @p lhs this way and false if
+     *          @p rhs has no object to steal (in which case nothing was done).
+     */
+    template<typename LHSType, typename RHSType>
+    bool steal_(LHSType& lhs, const RHSType& rhs) {
+        // Objects only known by their (abstract) base class can't be moved
+        if constexpr(std::is_abstract_v<object_type<LHSType>>) {
+            return false;
+        } else {
+            auto* pdonor = donor_(lhs, rhs);
+            if(pdonor == nullptr) return false;
+
+            auto ldonor = (*pdonor)(lhs.labels());
+            dispatch(ldonor, rhs);
+            lhs.object() = std::move(*pdonor);
+            return true;
+        }
+    }
+
+    /// Type of a read-only labeled object of the type assigned to
+    template<typename LHSType>
+    using labeled_const_type =
+      typename object_type<LHSType>::labeled_const_type;
+
+    /// Type of a container holding the temporaries for an operation
+    template<typename LHSType>
+    using temporaries_type = std::vector<
+      decltype(std::declval<object_type<LHSType>&>().clone())>;
+
+    /** @brief Returns @p rhs as a labeled object an operation can read from.
+     *
+     *  Labeled objects are returned as is, i.e., without copying them. The
+     *  exception is if @p rhs is also the object being assigned to, but with
+     *  different labels, since operations are allowed to modify their result
+     *  before they are done reading their operands. With the same labels
+     *  each element of the result only reads the corresponding element of
+     *  @p rhs, so the operation can be done in place. The exception, and
+     *  expressions, are evaluated into a new temporary which is kept alive
+     *  by @p temporaries.
+     */
+    template<typename LHSType, typename RHSType, typename TempsType>
+    labeled_const_type<LHSType> operand_(LHSType& lhs, const RHSType& rhs,
+                                         TempsType& temporaries) {
+        if constexpr(is_labeled<RHSType>::value) {
+            if(&rhs.object() != &lhs.object()) return rhs;
+            if(rhs.labels() == lhs.labels()) return rhs;
+        }
+        auto& ptemp = temporaries.emplace_back(lhs.object().clone());
+        auto ltemp  = (*ptemp)(lhs.labels());
+        dispatch(ltemp, rhs);
+        return ltemp;
+    }
+
+    /// Like operand_, but scalar factors of @p rhs are folded into @p alpha
+    template<typename LHSType, typename T, typename U, typename TempsType>
+    labeled_const_type<LHSType> operand_(
+      LHSType& lhs, const utilities::dsl::Multiply<T, U>& rhs,
+      TempsType& temporaries, double& alpha) {
+        if constexpr(std::is_floating_point_v<T>) {
+            alpha *= rhs.lhs();
+            return operand_(lhs, rhs.rhs(), temporaries, alpha);
+        } else if constexpr(std::is_floating_point_v<U>) {
+            alpha *= rhs.rhs();
+            return operand_(lhs, rhs.lhs(), temporaries, alpha);
+        } else {
+            return operand_(lhs, rhs, temporaries);
+        }
+    }
+
+    /// Operands which are not scalar multiples have no factors to fold
+    template<typename LHSType, typename RHSType, typename TempsType>
+    labeled_const_type<LHSType> operand_(LHSType& lhs, const RHSType& rhs,
+                                         TempsType& temporaries,
+                                         double& alpha) {
+        return operand_(lhs, rhs, temporaries);
+    }
+
+    /// Evaluates the linear expression @p rhs into @p lhs in one pass, then
+    /// accumulates the products of @p rhs into @p lhs
+    template<typename LHSType, typename RHSType>
+    void linear_dispatch_(LHSType& lhs, const RHSType& rhs) {
+        using terms_type = typename object_type<LHSType>::linear_terms_type;
+
+        if(steal_(lhs, rhs)) return;
+
+        terms_type terms;
+        temporaries_type<LHSType> temporaries;
+        add_terms_(lhs, 1.0, rhs, terms, temporaries);
+
+        // If every term is a product, the first product is assigned to lhs
+        bool assigned = !terms.empty();
+        if(assigned && !is_identity_(lhs, terms))
+            lhs.object().linear_combination_assignment(lhs.labels(), terms);
+        add_products_(lhs, 1.0, rhs, assigned, temporaries);
+    }
+
+    /// Is the linear combination @p terms just @p lhs, i.e., a no-op?
+    template<typename LHSType, typename TermsType>
+    static bool is_identity_(const LHSType& lhs, const TermsType& terms) {
+        if(terms.size() != 1) return false;
+        const auto& [c, term] = terms.front();
+        return c == 1.0 && &term.object() == &lhs.object() &&
+               term.labels() == lhs.labels();
+    }
+
+    /// Products are deferred (and accumulated into lhs by add_products_)
+    /// unless they read from lhs, which add_products_ will have changed
+    template<typename LHSType, typename RHSType>
+    static bool is_deferred_(const LHSType& lhs, const RHSType& rhs) {
+        return !references_(lhs, rhs);
+    }
+
+    /// Adds the terms of @p c * (A + B) to @p terms
+    template<typename LHSType, typename T, typename U, typename TermsType,
+             typename TempsType>
+    void add_terms_(LHSType& lhs, double c,
+                    const utilities::dsl::Add<T, U>& rhs, TermsType& terms,
+                    TempsType& temporaries) {
+        add_terms_(lhs, c, rhs.lhs(), terms, temporaries);
+        add_terms_(lhs, c, rhs.rhs(), terms, temporaries);
+    }
+
+    /// Adds the terms of @p c * (A - B) to @p terms
+    template<typename LHSType, typename T, typename U, typename TermsType,
+             typename TempsType>
+    void add_terms_(LHSType& lhs, double c,
+                    const utilities::dsl::Subtract<T, U>& rhs, TermsType& terms,
+                    TempsType& temporaries) {
+        add_terms_(lhs, c, rhs.lhs(), terms, temporaries);
+        add_terms_(lhs, -c, rhs.rhs(), terms, temporaries);
+    }
+
+    /// Folds scalars into the coefficient, other products become a temporary
+    template<typename LHSType, typename T, typename U, typename TermsType,
+             typename TempsType>
+    void add_terms_(LHSType& lhs, double c,
+                    const utilities::dsl::Multiply<T, U>& rhs, TermsType& terms,
+                    TempsType& temporaries) {
+        if constexpr(std::is_floating_point_v<T>) {
+            add_terms_(lhs, c * rhs.lhs(), rhs.rhs(), terms, temporaries);
+        } else if constexpr(std::is_floating_point_v<U>) {
+            add_terms_(lhs, c * rhs.rhs(), rhs.lhs(), terms, temporaries);
+        } else if(!is_deferred_(lhs, rhs)) {
+            add_temporary_(lhs, c, rhs, terms, temporaries);
+        }
+    }
+
+    /// Labeled objects are used as is if they only need to be permuted
+    template<typename LHSType, typename RHSType, typename TermsType,
+             typename TempsType>
+    void add_terms_(LHSType& lhs, double c, const RHSType& rhs,
+                    TermsType& terms, TempsType& temporaries) {
+        if(lhs.labels().is_permutation(rhs.labels()))
+            terms.emplace_back(c, rhs);
+        else // e.g., a trace
+            add_temporary_(lhs, c, rhs, terms, temporaries);
+    }
+
+    /// Evaluates @p rhs into a new temporary and adds it to @p terms
+    template<typename LHSType, typename RHSType, typename TermsType,
+             typename TempsType>
+    void add_temporary_(LHSType& lhs, double c, const RHSType& rhs,
+                        TermsType& terms, TempsType& temporaries) {
+        auto& ptemp = temporaries.emplace_back(lhs.object().clone());
+        auto ltemp  = (*ptemp)(lhs.labels());
+        dispatch(ltemp, rhs);
+        terms.emplace_back(c, ltemp);
+    }
+
+    /// Accumulates the deferred products of @p c * (A + B) into @p lhs
+    template<typename LHSType, typename T, typename U, typename TempsType>
+    void add_products_(LHSType& lhs, double c,
+                       const utilities::dsl::Add<T, U>& rhs, bool& assigned,
+                       TempsType& temporaries) {
+        add_products_(lhs, c, rhs.lhs(), assigned, temporaries);
+        add_products_(lhs, c, rhs.rhs(), assigned, temporaries);
+    }
+
+    /// Accumulates the deferred products of @p c * (A - B) into @p lhs
+    template<typename LHSType, typename T, typename U, typename TempsType>
+    void add_products_(LHSType& lhs, double c,
+                       const utilities::dsl::Subtract<T, U>& rhs,
+                       bool& assigned, TempsType& temporaries) {
+        add_products_(lhs, c, rhs.lhs(), assigned, temporaries);
+        add_products_(lhs, -c, rhs.rhs(), assigned, temporaries);
+    }
+
+    /// Folds scalars into the coefficient and accumulates deferred products.
+    /// @p c and the scalar factors of the product become the product's alpha
+    template<typename LHSType, typename T, typename U, typename TempsType>
+    void add_products_(LHSType& lhs, double c,
+                       const utilities::dsl::Multiply<T, U>& rhs,
+                       bool& assigned, TempsType& temporaries) {
+        if constexpr(std::is_floating_point_v<T>) {
+            add_products_(lhs, c * rhs.lhs(), rhs.rhs(), assigned, temporaries);
+        } else if constexpr(std::is_floating_point_v<U>) {
+            add_products_(lhs, c * rhs.rhs(), rhs.lhs(), assigned, temporaries);
+        } else if(is_deferred_(lhs, rhs)) {
+            double alpha = c;
+            auto lA      = operand_(lhs, rhs.lhs(), temporaries, alpha);
+            auto lB      = operand_(lhs, rhs.rhs(), temporaries, alpha);
+            auto& object = lhs.object();
+            if(assigned)
+                object.multiplication_accumulation(lhs.labels(), alpha, lA, lB);
+            else
+                object.multiplication_assignment(lhs.labels(), alpha, lA, lB);
+            assigned = true;
+        }
+    }
+
+    /// Labeled objects were already handled by add_terms_
+    template<typename LHSType, typename RHSType, typename TempsType>
+    void add_products_(LHSType& lhs, double c, const RHSType& rhs,
+                       bool& assigned, TempsType& temporaries) {}
 };
 
 } // namespace tensorwrapper::dsl
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <tensorwrapper/layout/logical.hpp>
+#include <tensorwrapper/layout/physical.hpp>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace tensorwrapper::layout {
+
+/** @brief Converts a logical layout into a physical layout.
+ *
+ *  By default the physical layout is dense and row-major. The modes can
+ *  instead be laid out in column-major order (e.g., to share the elements
+ *  with Fortran code) and/or the contiguous mode can be padded (e.g., to keep
+ *  power-of-two extents from mapping to the same cache sets).
+ *
+ *  The modes can also be stored in an order other than the logical one. The
+ *  order is either given explicitly, or worked out from the contractions
+ *  recorded with record_contraction. In the latter case the modes which are
+ *  summed over most often are made the fastest varying ones, which lets the
+ *  contractions be done as GEMMs without transposing the tensor first. The
+ *  logical layout, and thus how users index the tensor, is unchanged.
+ *
+ *  Passing a Converter to the Tensor ctor makes the tensor's physical layout
+ *  with convert(logical), e.g., `Tensor t(shape, Converter({1, 0}));` stores
+ *  a matrix in column-major order.
+ */
+class Converter {
+public:
+    using logical_type            = Logical;
+    using const_logical_reference = const logical_type&;
+    using physical_type           = Physical;
+    using physical_pointer        = std::unique_ptr<physical_type>;
+    using size_type               = typename physical_type::size_type;
+
+    /// Type used to list modes by their offsets in the logical layout
+    using mode_vector = std::vector<size_type>;
+
+    /// Makes a Converter which lays out the modes in the logical order
+    Converter() = default;
+
+    /** @brief Makes a Converter which always lays out the modes in the order
+     *         @p mode_order.
+     *
+     *  @param[in] mode_order The modes from the slowest to the fastest
+     *                        varying. Used by convert(logical) in place of
+     *                        the order from the recorded contractions.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit Converter(mode_vector mode_order) noexcept :
+      m_mode_order_(std::move(mode_order)) {}
+
+    /** @brief Makes a physical layout for @p logical.
+     *
+     *  If *this was given a mode order, the modes are laid out in that order.
+     *  Otherwise, if contractions have been recorded, the modes are laid out
+     *  in the order returned by preferred_mode_order. Otherwise the layout is
+     *  dense and row-major.
+     *
+     *  @param[in] logical The logical layout to convert.
+     *
+     *  @return The physical layout.
+     *
+     *  @throw std::runtime_error if *this was given a mode order which is not
+     *                            a permutation of the modes of @p logical.
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the layout.
+     *                        Strong throw guarantee.
+     */
+    physical_pointer convert(const_logical_reference logical) const {
+        if(logical.is_null()) return convert(logical, StorageOrder::row_major);
+        if(!m_mode_order_.empty()) return convert(logical, m_mode_order_);
+        if(m_summed_counts_.empty())
+            return convert(logical, StorageOrder::row_major);
+        return convert(logical, preferred_mode_order(logical.rank()));
+    }
+
+    /** @brief Makes a physical layout for @p logical.
+     *
+     *  @param[in] logical The logical layout to convert.
+     *  @param[in] order The order to lay the modes out in.
+     *  @param[in] padding The number of elements to pad the contiguous mode
+     *                     by. Defaults to 0.
+     *
+     *  @return The physical layout.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the layout.
+     *                        Strong throw guarantee.
+     */
+    physical_pointer convert(const_logical_reference logical,
+                             StorageOrder order, size_type padding = 0) const {
+        const bool is_default = order == StorageOrder::row_major && !padding;
+        if(is_default || logical.is_null()) {
+            return std::make_unique<physical_type>(
+              logical.shape(), logical.symmetry(), logical.sparsity());
+        }
+        const auto& shape = logical.shape();
+        auto strides      = physical_type::make_strides(shape, order, padding);
+        return std::make_unique<physical_type>(
+          shape, logical.symmetry(), logical.sparsity(), std::move(strides));
+    }
+
+    /** @brief Makes a physical layout for @p logical which stores the modes
+     *         in the order @p mode_order.
+     *
+     *  @param[in] logical The logical layout to convert.
+     *  @param[in] mode_order The modes of @p logical from the slowest to the
+     *                        fastest varying, e.g., {1, 0} stores a matrix
+     *                        in column-major order.
+     *
+     *  @return The physical layout.
+     *
+     *  @throw std::runtime_error if @p mode_order is not a permutation of the
+     *                            modes of @p logical. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the layout.
+     *                        Strong throw guarantee.
+     */
+    physical_pointer convert(const_logical_reference logical,
+                             const mode_vector& mode_order) const {
+        const auto rank = logical.rank();
+        std::vector<bool> seen(rank, false);
+        for(auto mode : mode_order) {
+            if(mode >= rank || seen[mode])
+                throw std::runtime_error(
+                  "Mode order must be a permutation of the modes.");
+            seen[mode] = true;
+        }
+        if(mode_order.size() != rank)
+            throw std::runtime_error(
+              "Mode order must be a permutation of the modes.");
+
+        const auto& shape = logical.shape();
+        const auto smooth = shape.as_smooth();
+        typename physical_type::stride_vector strides(rank);
+        size_type stride = 1;
+        for(size_type i = rank; i-- > 0;) {
+            strides[mode_order[i]] = stride;
+            stride *= smooth.extent(mode_order[i]);
+        }
+        return std::make_unique<physical_type>(
+          shape, logical.symmetry(), logical.sparsity(), std::move(strides));
+    }
+
+    /** @brief Records that the tensors laid out by *this are contracted over
+     *         the modes @p summed_modes.
+     *
+     *  @param[in] summed_modes The offsets of the modes which are summed
+     *                          over.
+     *
+     *  @throw std::bad_alloc if there is a problem recording the modes.
+     *                        Weak throw guarantee.
+     */
+    void record_contraction(const mode_vector& summed_modes) {
+        for(auto mode : summed_modes) {
+            if(mode >= m_summed_counts_.size())
+                m_summed_counts_.resize(mode + 1, 0);
+            ++m_summed_counts_[mode];
+        }
+    }
+
+    /** @brief The order the modes of a rank @p rank tensor are laid out in,
+     *         given the recorded contractions.
+     *
+     *  Modes are ordered by how often they were summed over, with the most
+     *  often summed over modes last, i.e., fastest varying. Modes which were
+     *  summed over equally often keep their logical order. Hence, if no
+     *  contractions were recorded the order is the logical order.
+     *
+     *  @param[in] rank The number of modes.
+     *
+     *  @return The modes from the slowest to the fastest varying.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    mode_vector preferred_mode_order(size_type rank) const {
+        auto count = [this](size_type mode) {
+            return mode < m_summed_counts_.size() ? m_summed_counts_[mode] : 0;
+        };
+        mode_vector rv(rank);
+        std::iota(rv.begin(), rv.end(), size_type{0});
+        std::stable_sort(rv.begin(), rv.end(), [&](size_type a, size_type b) {
+            return count(a) < count(b);
+        });
+        return rv;
+    }
+
+private:
+    /// The order given by the user, empty if the order is not fixed
+    mode_vector m_mode_order_;
+
+    /// How many recorded contractions summed over each mode
+    std::vector<size_type> m_summed_counts_;
+};
+
+} // namespace tensorwrapper::layout
@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <tensorwrapper/layout/converter.hpp>
 #include <tensorwrapper/layout/logical.hpp>
 #include <tensorwrapper/layout/physical.hpp>
 
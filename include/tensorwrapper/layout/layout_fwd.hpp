@@ -18,6 +18,7 @@
 
 namespace tensorwrapper::layout {
 
+class Converter;
 class LayoutBase;
 
 template<typename Derived>
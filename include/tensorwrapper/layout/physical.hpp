@@ -16,15 +16,37 @@
 
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
 #include <tensorwrapper/layout/layout_common.hpp>
+#include <vector>
+
 namespace tensorwrapper::layout {
 
+/// The order in which the modes of a tensor are laid out in memory
+enum class StorageOrder {
+    /// The last mode is contiguous (C order)
+    row_major,
+    /// The first mode is contiguous (Fortran order)
+    column_major
+};
+
 /** @brief Specializes a LayoutBase for a layout describing how a tensor is
  *         actually laid out at runtime.
  *
- *  At present this class is largely a strong type, but eventually we expect it
- *  to hold details such as row major vs column major that matter for the
- *  physical layout, but not the logical layout.
+ *  In addition to the state of the logical layout, the physical layout knows
+ *  how the elements are laid out in memory. This is described by the stride
+ *  of each mode, i.e., how many elements apart two elements whose offsets
+ *  differ by one along that mode are. By default the layout is dense and
+ *  row-major. Column-major layouts, and layouts whose contiguous mode is
+ *  padded (e.g., to a leading dimension which is not a power of two), can
+ *  be made with the StorageOrder ctor. Any other strides can be provided
+ *  explicitly, as long as they do not map two elements to the same place.
+ *  This is checked by requiring the modes to nest: ordered by stride, each
+ *  mode must start past the end of the faster varying modes.
+ *
+ *  The DSL operations and slicing produce dense row-major layouts.
  */
 class Physical : public LayoutCommon<Physical> {
 private:
@@ -39,6 +61,9 @@ public:
     using my_base_type::layout_pointer;
     using my_base_type::size_type;
 
+    /// Type used to hold the strides of the modes
+    using stride_vector = std::vector<size_type>;
+
     Physical() = default;
 
     Physical(const_shape_reference shape, const_symmetry_reference symmetry,
@@ -54,6 +79,170 @@ public:
 
     Physical(shape_pointer pshape) : my_base_type(std::move(pshape)) {}
 
+    /** @brief Lays out a tensor with shape @p shape in the order @p order.
+     *
+     *  See make_strides for how the strides are worked out.
+     *
+     *  @param[in] shape The shape of the tensor.
+     *  @param[in] order Which mode is contiguous.
+     *  @param[in] padding How many elements to pad the contiguous mode by.
+     *                     Defaults to 0.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the state.
+     *                        Strong throw guarantee.
+     */
+    Physical(const_shape_reference shape, StorageOrder order,
+             size_type padding = 0) :
+      Physical(shape, make_strides(shape, order, padding)) {}
+
+    /** @brief Lays out a tensor with shape @p shape using @p strides.
+     *
+     *  The tensor has no symmetry and no sparsity.
+     *
+     *  @param[in] shape The shape of the tensor.
+     *  @param[in] strides The stride of each mode of the tensor.
+     *
+     *  @throw std::runtime_error if the number of strides is not the rank of
+     *                            @p shape. Strong throw guarantee.
+     *  @throw std::invalid_argument if @p strides map two elements to the
+     *                               same place. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the state.
+     *                        Strong throw guarantee.
+     */
+    Physical(const_shape_reference shape, stride_vector strides) :
+      Physical(shape, symmetry_type(shape.rank()), sparsity_type(shape.rank()),
+               std::move(strides)) {}
+
+    /** @brief Lays out a tensor using @p strides.
+     *
+     *  @param[in] shape The shape of the tensor.
+     *  @param[in] symmetry The symmetry of the tensor.
+     *  @param[in] sparsity The sparsity of the tensor.
+     *  @param[in] strides The stride of each mode of the tensor.
+     *
+     *  @throw std::runtime_error if the number of strides is not the rank of
+     *                            @p shape. Strong throw guarantee.
+     *  @throw std::invalid_argument if @p strides map two elements to the
+     *                               same place (e.g., a stride is zero).
+     *                               Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the state.
+     *                        Strong throw guarantee.
+     */
+    Physical(const_shape_reference shape, const_symmetry_reference symmetry,
+             const_sparsity_reference sparsity, stride_vector strides) :
+      my_base_type(shape, symmetry, sparsity), m_strides_(std::move(strides)) {
+        if(m_strides_.size() != shape.rank())
+            throw std::runtime_error(
+              "The number of strides must match the rank of the shape.");
+        assert_no_overlap_();
+        if(m_strides_ == row_major_strides_()) m_strides_.clear();
+    }
+
+    /** @brief Works out the strides of a tensor laid out in order @p order.
+     *
+     *  The contiguous mode (the last for row-major, the first for
+     *  column-major) has a stride of one. It is padded with @p padding
+     *  elements, i.e., the stride of the next mode is the extent of the
+     *  contiguous mode plus @p padding. The remaining strides follow as for a
+     *  dense layout.
+     *
+     *  @param[in] shape The shape of the tensor.
+     *  @param[in] order Which mode is contiguous.
+     *  @param[in] padding How many elements to pad the contiguous mode by.
+     *                     Defaults to 0.
+     *
+     *  @return The stride of each mode of the tensor.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    static stride_vector make_strides(const_shape_reference shape,
+                                      StorageOrder order,
+                                      size_type padding = 0) {
+        const auto smooth = shape.as_smooth();
+        const auto rank   = smooth.rank();
+        stride_vector rv(rank);
+        size_type stride = 1;
+        for(size_type n = 0; n < rank; ++n) {
+            const auto i = order == StorageOrder::row_major ? rank - 1 - n : n;
+            rv[i]        = stride;
+            stride *= smooth.extent(i) + (n == 0 ? padding : 0);
+        }
+        return rv;
+    }
+
+    // -------------------------------------------------------------------------
+    // -- State methods
+    // -------------------------------------------------------------------------
+
+    /** @brief The stride of each mode of *this.
+     *
+     *  @return The number of elements between elements whose offsets along
+     *          mode i differ by one, for each mode i.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    stride_vector strides() const {
+        return is_row_major() ? row_major_strides_() : m_strides_;
+    }
+
+    /** @brief Is *this dense and row-major?
+     *
+     *  @return True if the elements are laid out densely in row-major order
+     *          and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_row_major() const noexcept { return m_strides_.empty(); }
+
+    /** @brief How many elements the memory holding *this must have.
+     *
+     *  For a dense layout this is the number of elements. Padded or otherwise
+     *  strided layouts need more, i.e., one more than the offset of the last
+     *  element.
+     *
+     *  @return The number of elements the memory must hold.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type storage_size() const noexcept {
+        if(is_null()) return 0;
+        const auto smooth = shape().as_smooth();
+        if(is_row_major()) return smooth.size();
+        size_type rv = 1;
+        for(size_type i = 0; i < smooth.rank(); ++i) {
+            if(smooth.extent(i) == 0) return 0;
+            rv += (smooth.extent(i) - 1) * m_strides_[i];
+        }
+        return rv;
+    }
+
+    // -------------------------------------------------------------------------
+    // -- Utility methods
+    // -------------------------------------------------------------------------
+
+    /** @brief Is *this value equal to @p rhs?
+     *
+     *  Two physical layouts are value equal if they are value equal as
+     *  layouts and the modes have the same strides.
+     *
+     *  @param[in] rhs The layout to compare to.
+     *
+     *  @return True if *this is value equal to @p rhs and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool operator==(const Physical& rhs) const noexcept {
+        if(!my_base_type::operator==(rhs)) return false;
+        return m_strides_ == rhs.m_strides_;
+    }
+
+    /// Is *this different from @p rhs?
+    bool operator!=(const Physical& rhs) const noexcept {
+        return !((*this) == rhs);
+    }
+
 protected:
     /// Implements clone by calling copy ctor
     layout_pointer clone_() const override {
@@ -64,6 +253,71 @@ protected:
     bool are_equal_(const layout_base& rhs) const noexcept override {
         return are_equal_impl_<Physical>(rhs);
     }
+
+    /// The results of the DSL operations are dense and row-major
+    ///@{
+    dsl_reference addition_assignment_(label_type this_labels,
+                                       const_labeled_reference lhs,
+                                       const_labeled_reference rhs) override {
+        m_strides_.clear();
+        return my_base_type::addition_assignment_(this_labels, lhs, rhs);
+    }
+
+    dsl_reference subtraction_assignment_(
+      label_type this_labels, const_labeled_reference lhs,
+      const_labeled_reference rhs) override {
+        m_strides_.clear();
+        return my_base_type::subtraction_assignment_(this_labels, lhs, rhs);
+    }
+
+    dsl_reference multiplication_assignment_(
+      label_type this_labels, const_labeled_reference lhs,
+      const_labeled_reference rhs) override {
+        m_strides_.clear();
+        return my_base_type::multiplication_assignment_(this_labels, lhs, rhs);
+    }
+
+    dsl_reference permute_assignment_(label_type this_labels,
+                                      const_labeled_reference rhs) override {
+        m_strides_.clear();
+        return my_base_type::permute_assignment_(this_labels, rhs);
+    }
+    ///@}
+
+private:
+    /// Throws std::invalid_argument unless the modes, ordered by stride, nest
+    void assert_no_overlap_() const {
+        const auto smooth = shape().as_smooth();
+        const auto rank   = smooth.rank();
+        for(size_type i = 0; i < rank; ++i)
+            if(smooth.extent(i) == 0) return; // No elements, nothing overlaps
+
+        std::vector<size_type> order(rank);
+        std::iota(order.begin(), order.end(), size_type{0});
+        std::sort(order.begin(), order.end(), [this](auto a, auto b) {
+            return m_strides_[a] < m_strides_[b];
+        });
+
+        // Modes of extent one never move, so their strides do not matter
+        size_type end = 1; // One past the last offset of the faster modes
+        for(auto mode : order) {
+            const auto extent = smooth.extent(mode);
+            if(extent == 1) continue;
+            if(m_strides_[mode] < end)
+                throw std::invalid_argument(
+                  "The strides map two elements to the same place.");
+            end = m_strides_[mode] * (extent - 1) + end;
+        }
+    }
+
+    /// The strides of a dense row-major layout with the shape of *this
+    stride_vector row_major_strides_() const {
+        if(is_null()) return {};
+        return make_strides(shape(), StorageOrder::row_major);
+    }
+
+    /// The strides of the modes, empty if *this is dense and row-major
+    stride_vector m_strides_;
 };
 
 } // namespace tensorwrapper::layout
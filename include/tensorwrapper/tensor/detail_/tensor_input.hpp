@@ -18,6 +18,7 @@
 #include <memory>
 #include <parallelzone/parallelzone.hpp>
 #include <tensorwrapper/buffer/buffer_base.hpp>
+#include <tensorwrapper/layout/converter.hpp>
 #include <tensorwrapper/layout/layout_base.hpp>
 #include <tensorwrapper/layout/logical.hpp>
 #include <tensorwrapper/layout/physical.hpp>
@@ -89,6 +90,15 @@ struct TensorInput {
     /// Type of a pointer to an object of type physical_layout_type
     using physical_layout_pointer = std::unique_ptr<physical_layout_type>;
 
+    /// Type which makes physical layouts from logical layouts
+    using converter_type = layout::Converter;
+
+    /// Type of a read-only reference to an object of type converter_type
+    using const_converter_reference = const converter_type&;
+
+    /// Type of a pointer to an object of type converter_type
+    using converter_pointer = std::unique_ptr<converter_type>;
+
     /// Type all buffer object's inherit from
     using buffer_base = typename buffer::BufferBase;
 
@@ -181,6 +191,17 @@ struct TensorInput {
         m_pphysical = std::move(pphysical);
     }
 
+    template<typename... Args>
+    TensorInput(const_converter_reference converter, Args&&... args) :
+      TensorInput(std::make_unique<converter_type>(converter),
+                  std::forward<Args>(args)...) {}
+
+    template<typename... Args>
+    TensorInput(converter_pointer pconverter, Args&&... args) :
+      TensorInput(std::forward<Args>(args)...) {
+        m_pconverter = std::move(pconverter);
+    }
+
     template<typename... Args>
     TensorInput(const_buffer_reference buffer, Args&&... args) :
       TensorInput(buffer.clone(), std::forward<Args>(args)...) {}
@@ -221,6 +242,8 @@ struct TensorInput {
 
     bool has_physical_layout() const noexcept { return m_pphysical != nullptr; }
 
+    bool has_converter() const noexcept { return m_pconverter != nullptr; }
+
     bool has_buffer() const noexcept { return m_pbuffer != nullptr; }
     ///@}
 
@@ -234,6 +257,8 @@ struct TensorInput {
 
     physical_layout_pointer m_pphysical;
 
+    converter_pointer m_pconverter;
+
     buffer_pointer m_pbuffer;
 
     runtime_view_type m_rv;
@@ -214,7 +214,11 @@ public:
     Tensor(tensor4_il_type il);
     ///@}
 
-    /** @brief Initializes *this with a deep copy of @p other.
+    /** @brief Initializes *this with a copy of @p other.
+     *
+     *  The copy is logically a deep copy, but the elements of the buffer are
+     *  shared (copy-on-write) until either tensor modifies them. Copying a
+     *  tensor is thus cheap regardless of how many elements it has.
      *
      *  @param[in] other The tensor to copy.
      *
@@ -232,15 +236,15 @@ public:
      */
     Tensor(Tensor&& other) noexcept;
 
-    /** @brief Overwrites the state of *this with a deep copy of @p rhs.
+    /** @brief Overwrites the state of *this with a copy of @p rhs.
      *
      *  This method will release the state currently owned by *this and
-     *  overwrite it with a deep copy of @p rhs. The copy will occur through
+     *  overwrite it with a copy of @p rhs. The copy will occur through
      *  Tensor's copy ctor, so see that method for more details.
      *
      *  @param[in] rhs The tensor to copy.
      *
-     *  @return *this after replacing its state with a deep copy of @p rhs.
+     *  @return *this after replacing its state with a copy of @p rhs.
      *
      *  @throw std::bad_alloc if there is a problem allocating the copy. Strong
      *                        throw guarantee.
@@ -390,6 +394,16 @@ protected:
       label_type this_labels, const_labeled_reference lhs,
       const_labeled_reference rhs) override;
 
+    /// Like multiplication_assignment_, but the buffer scales the product
+    dsl_reference scaled_multiplication_assignment_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs) override;
+
+    /// Calls multiplication_accumulation on the buffer of *this
+    dsl_reference multiplication_accumulation_(
+      label_type this_labels, double alpha, const_labeled_reference lhs,
+      const_labeled_reference rhs) override;
+
     /// Calls scalar_multiplication on each member
     dsl_reference scalar_multiplication_(label_type this_labels, double scalar,
                                          const_labeled_reference rhs) override;
@@ -398,6 +412,10 @@ protected:
     dsl_reference permute_assignment_(label_type this_labels,
                                       const_labeled_reference rhs) override;
 
+    /// Permutes the layout and calls linear_combination_assignment on buffer
+    dsl_reference linear_combination_assignment_(
+      label_type this_labels, const linear_terms_type& terms) override;
+
     /// Implements to_string
     typename polymorphic_base::string_type to_string_() const override;
 
@@ -408,6 +426,30 @@ private:
                                  const_labeled_reference lhs,
                                  const_labeled_reference rhs);
 
+    /// Type of a list of the buffers an operation reads from
+    using input_buffers_type = std::vector<const input_type::buffer_base*>;
+
+    /** @brief Code factorization for storing the result of an operation.
+     *
+     *  If *this already has a buffer, @p fxn computes the result directly
+     *  into that buffer. If the operation also reads from that buffer this
+     *  is only done if the result has as many elements as the buffer, since
+     *  the elements being read can not be reallocated (the backend handles
+     *  reading and writing the same elements). Otherwise @p fxn is given a
+     *  new, empty buffer to compute the result into.
+     *
+     *  @param[in] fxn A callable taking the buffer the result goes into.
+     *  @param[in] playout The logical layout of the result.
+     *  @param[in] inputs The buffers @p fxn will read from.
+     *
+     *  @throw ??? If @p fxn throws. Strong throw guarantee if a new buffer was
+     *             needed, otherwise the elements of *this may have been
+     *             overwritten.
+     */
+    template<typename FxnType>
+    dsl_reference assign_result_(FxnType&& fxn, logical_layout_pointer playout,
+                                 const input_buffers_type& inputs);
+
     /// All ctors ultimately dispatch to this ctor
     Tensor(pimpl_pointer pimpl) noexcept;
 
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <tensorwrapper/tensor/tensor.hpp>
+#include <utility>
+#include <vector>
+
+namespace tensorwrapper::utilities {
+
+/** @brief Assembles a tensor out of blocks.
+ *
+ *  Each block is a pair whose first element is the index of the block's first
+ *  element in the result and whose second element is the block itself. The
+ *  blocks are copied into the result a row at a time (see
+ *  buffer::Contiguous::assign_block). Elements not covered by any block are
+ *  zero, and where blocks overlap the later block wins.
+ *
+ *  @param[in] extents The extents of the modes of the result.
+ *  @param[in] blocks The blocks to copy into the result. All blocks must have
+ *                    the same rank as the result and the same floating point
+ *                    type.
+ *
+ *  @return A tensor with extents @p extents containing the elements of
+ *          @p blocks. If @p blocks is empty a default-constructed tensor is
+ *          returned.
+ *
+ *  @throw std::out_of_range if a block does not fit in the result. Strong
+ *                           throw guarantee.
+ *  @throw std::runtime_error if the blocks have different floating point
+ *                            types. Strong throw guarantee.
+ */
+Tensor assemble_blocks(
+  const std::vector<std::size_t>& extents,
+  const std::vector<std::pair<std::vector<std::size_t>, Tensor>>& blocks);
+
+} // namespace tensorwrapper::utilities
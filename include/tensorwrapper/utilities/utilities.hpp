@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <tensorwrapper/utilities/assemble_blocks.hpp>
 #include <tensorwrapper/utilities/block_diagonal_matrix.hpp>
 #include <tensorwrapper/utilities/diagonal_matrix.hpp>
 #include <tensorwrapper/utilities/make_tensor.hpp>
@@ -40,8 +40,11 @@ struct GetBufferDataKernel {
     using size_type  = std::size_t;
     using shape_type = shape::Smooth;
 
-    GetBufferDataKernel(size_type rank, shape_type& smooth_shape) :
-      m_rank(rank), m_psmooth_shape(&smooth_shape) {}
+    GetBufferDataKernel(size_type rank, shape_type& smooth_shape,
+                        std::vector<size_type> element_strides) :
+      m_rank(rank),
+      m_psmooth_shape(&smooth_shape),
+      m_element_strides(std::move(element_strides)) {}
 
     template<concepts::FloatingPoint FloatType>
     pybind11::buffer_info operator()(std::span<FloatType> buffer) {
@@ -59,11 +62,8 @@ struct GetBufferDataKernel {
         std::vector<size_type> shape(rank);
         std::vector<size_type> strides(rank);
         for(size_type rank_i = 0; rank_i < rank; ++rank_i) {
-            shape[rank_i]      = m_psmooth_shape->extent(rank_i);
-            size_type stride_i = 1;
-            for(size_type mode_i = rank_i + 1; mode_i < rank; ++mode_i)
-                stride_i *= m_psmooth_shape->extent(mode_i);
-            strides[rank_i] = stride_i * nbytes;
+            shape[rank_i]   = m_psmooth_shape->extent(rank_i);
+            strides[rank_i] = m_element_strides[rank_i] * nbytes;
         }
         auto* ptr = const_cast<clean_type*>(buffer.data());
         return pybind11::buffer_info(ptr, nbytes, desc, rank, shape, strides);
@@ -71,6 +71,9 @@ struct GetBufferDataKernel {
 
     size_type m_rank;
     shape_type* m_psmooth_shape;
+
+    /// How many elements apart consecutive offsets along each mode are
+    std::vector<size_type> m_element_strides;
 };
 
 template<typename FloatType>
@@ -79,18 +82,29 @@ Tensor make_tensor_(pybind11::buffer_info& info) {
         throw std::runtime_error(
           "Incompatible format: expected a float array!");
 
-    // Work out physical layout of tensor
+    // Work out physical layout of tensor. The elements are copied in the
+    // order they are laid out in (e.g., C or Fortran order), so the array's
+    // strides become those of the layout.
     std::vector<std::size_t> dims(info.ndim);
-    for(auto i = 0; i < info.ndim; ++i) { dims[i] = info.shape[i]; }
+    std::vector<std::size_t> strides(info.ndim);
+    for(auto i = 0; i < info.ndim; ++i) {
+        dims[i] = info.shape[i];
+        if(info.strides[i] < 0 || info.strides[i] % info.itemsize != 0)
+            throw std::runtime_error(
+              "Incompatible strides: expected non-negative multiples of the "
+              "element size!");
+        strides[i] = info.strides[i] / info.itemsize;
+    }
     shape::Smooth shape(dims.begin(), dims.end());
-    layout::Physical layout(shape);
+    layout::Physical layout(shape, strides);
 
     // Fill in Buffer object
-    auto n_elements = shape.size();
-    std::vector<FloatType> data(n_elements);
-    auto pData = static_cast<FloatType*>(info.ptr);
-    std::copy(pData, pData + n_elements, data.begin());
-    auto pBuffer = std::make_unique<buffer::Contiguous>(data, shape);
+    auto n_elements = layout.storage_size();
+    auto pData      = static_cast<FloatType*>(info.ptr);
+    std::vector<FloatType> data(pData, pData + n_elements);
+    using buffer_type = typename buffer::Contiguous::buffer_type;
+    auto pBuffer      = std::make_unique<buffer::Contiguous>(
+      buffer_type(std::move(data)), layout);
 
     return Tensor(shape, std::move(pBuffer));
 }
@@ -103,7 +117,11 @@ auto make_buffer_info(buffer::Contiguous& buffer) {
     std::vector<std::size_t> extents(rank);
     for(std::size_t i = 0; i < rank; ++i) extents[i] = smooth_shape.extent(i);
     shape::Smooth shape(extents.begin(), extents.end());
-    GetBufferDataKernel kernel(rank, shape);
+    // The elements are viewed where they are, laid out as the layout says.
+    // N.b. the view is mutable, so the buffer stops sharing its elements:
+    // they are copied now if shared, and copies made while the view may be
+    // in use get their own (see Contiguous::get_mutable_data)
+    GetBufferDataKernel kernel(rank, shape, buffer.layout().strides());
     return buffer::visit_contiguous_buffer(kernel, buffer);
 }
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cblas_gemm.hpp"
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef ENABLE_CBLAS
+#include <cblas.h>
+#endif
+
+namespace tensorwrapper::backends::cblas {
+
+template<typename FloatType>
+void gemm(bool trans_a, bool trans_b, std::size_t m, std::size_t n,
+          std::size_t k, FloatType alpha, const FloatType* a, std::size_t lda,
+          const FloatType* b, std::size_t ldb, FloatType beta, FloatType* c,
+          std::size_t ldc) {
+#ifdef ENABLE_CBLAS
+    // CBLAS refuses to run with a leading dimension of 0, which happens for
+    // empty matrices
+    if(m == 0 || n == 0) return;
+    if(k == 0) {
+        for(std::size_t i = 0; i < m; ++i)
+            for(std::size_t j = 0; j < n; ++j)
+                c[i * ldc + j] =
+                  beta == FloatType{0} ? FloatType{0} : beta * c[i * ldc + j];
+        return;
+    }
+
+    const auto ta = trans_a ? CblasTrans : CblasNoTrans;
+    const auto tb = trans_b ? CblasTrans : CblasNoTrans;
+    const auto im = static_cast<int>(m);
+    const auto in = static_cast<int>(n);
+    const auto ik = static_cast<int>(k);
+    const auto ia = static_cast<int>(lda);
+    const auto ib = static_cast<int>(ldb);
+    const auto ic = static_cast<int>(ldc);
+    if constexpr(std::is_same_v<FloatType, float>) {
+        cblas_sgemm(CblasRowMajor, ta, tb, im, in, ik, alpha, a, ia, b, ib,
+                    beta, c, ic);
+    } else {
+        cblas_dgemm(CblasRowMajor, ta, tb, im, in, ik, alpha, a, ia, b, ib,
+                    beta, c, ic);
+    }
+#else
+    throw std::runtime_error(
+      "CBLAS backend not enabled. Recompile with -DENABLE_CBLAS.");
+#endif
+}
+
+template void gemm<float>(bool, bool, std::size_t, std::size_t, std::size_t,
+                          float, const float*, std::size_t, const float*,
+                          std::size_t, float, float*, std::size_t);
+template void gemm<double>(bool, bool, std::size_t, std::size_t, std::size_t,
+                           double, const double*, std::size_t, const double*,
+                           std::size_t, double, double*, std::size_t);
+
+} // namespace tensorwrapper::backends::cblas
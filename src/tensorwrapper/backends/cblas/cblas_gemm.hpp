@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace tensorwrapper::backends::cblas {
+
+/** @brief Computes C = alpha * op(A) * op(B) + beta * C with the system CBLAS
+ *         library.
+ *
+ *  All matrices are row-major. op(A) is @p m by @p k, op(B) is @p k by @p n,
+ *  and C is @p m by @p n. If @p trans_a is true, A is stored as a @p k by
+ *  @p m matrix and op(A) is its transpose (likewise for @p trans_b). The
+ *  leading dimensions are the strides between the rows of the stored
+ *  matrices. If @p beta is zero the initial contents of @p c are ignored.
+ *
+ *  @tparam FloatType Either float or double.
+ *
+ *  @throw std::runtime_error if TensorWrapper was not built with CBLAS
+ *                            support. Strong throw guarantee.
+ */
+template<typename FloatType>
+void gemm(bool trans_a, bool trans_b, std::size_t m, std::size_t n,
+          std::size_t k, FloatType alpha, const FloatType* a, std::size_t lda,
+          const FloatType* b, std::size_t ldb, FloatType beta, FloatType* c,
+          std::size_t ldc);
+
+extern template void gemm<float>(bool, bool, std::size_t, std::size_t,
+                                 std::size_t, float, const float*, std::size_t,
+                                 const float*, std::size_t, float, float*,
+                                 std::size_t);
+extern template void gemm<double>(bool, bool, std::size_t, std::size_t,
+                                  std::size_t, double, const double*,
+                                  std::size_t, const double*, std::size_t,
+                                  double, double*, std::size_t);
+
+} // namespace tensorwrapper::backends::cblas
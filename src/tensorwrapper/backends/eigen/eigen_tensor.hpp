@@ -86,6 +86,15 @@ public:
     /// Type of a label
     using label_type = dsl::DummyIndices<string_type>;
 
+    /// Type of the coefficients of a linear combination
+    using coefficient_vector = std::vector<value_type>;
+
+    /// Type of the labels of the terms of a linear combination
+    using label_vector = std::vector<label_type>;
+
+    /// Type of the tensors of a linear combination
+    using const_tensor_vector = std::vector<const EigenTensor*>;
+
     /// Type returned by permuted_copy
     using permuted_copy_return_type =
       std::pair<std::vector<FloatType>, eigen_tensor_pointer>;
@@ -151,16 +160,25 @@ public:
                                        rhs);
     }
 
+    /// Sets *this to alpha * lhs * rhs + beta * (*this), element-wise
     void hadamard_assignment(label_type this_label, label_type lhs_label,
                              label_type rhs_label, const EigenTensor& lhs,
-                             const EigenTensor& rhs) {
-        return hadamard_assignment_(this_label, lhs_label, rhs_label, lhs, rhs);
+                             const EigenTensor& rhs,
+                             FloatType alpha = FloatType{1},
+                             FloatType beta = FloatType{0}) {
+        return hadamard_assignment_(this_label, lhs_label, rhs_label, lhs, rhs,
+                                    alpha, beta);
     }
 
+    /// Sets *this to alpha * lhs * rhs + beta * (*this), summing over shared
+    /// modes. If @p beta is zero the initial contents of *this are not read
     void contraction_assignment(label_type this_label, label_type lhs_label,
                                 label_type rhs_label, const EigenTensor& lhs,
-                                const EigenTensor& rhs) {
-        contraction_assignment_(this_label, lhs_label, rhs_label, lhs, rhs);
+                                const EigenTensor& rhs,
+                                FloatType alpha = FloatType{1},
+                                FloatType beta = FloatType{0}) {
+        contraction_assignment_(this_label, lhs_label, rhs_label, lhs, rhs,
+                                alpha, beta);
     }
 
     void permute_assignment(label_type this_label, label_type rhs_label,
@@ -173,6 +191,23 @@ public:
         return scalar_multiplication_(this_label, rhs_label, scalar, rhs);
     }
 
+    /** @brief Sets *this to sum_i coefficients[i] * tensors[i].
+     *
+     *  The i-th tensor is labeled by labels[i], which must be a permutation
+     *  of @p this_label. All of the terms are combined in one pass over
+     *  *this (a few passes for very many terms). Terms which are *this
+     *  itself, labeled by @p this_label, are accumulated in place.
+     */
+    void linear_combination_assignment(label_type this_label,
+                                       const coefficient_vector& coefficients,
+                                       const label_vector& labels,
+                                       const const_tensor_vector& tensors) {
+        assert(coefficients.size() == tensors.size());
+        assert(labels.size() == tensors.size());
+        linear_combination_assignment_(this_label, coefficients, labels,
+                                       tensors);
+    }
+
 protected:
     explicit EigenTensor() noexcept = default;
     virtual permuted_copy_return_type permuted_copy_(
@@ -203,7 +238,8 @@ protected:
                                       label_type lhs_label,
                                       label_type rhs_label,
                                       const EigenTensor& lhs,
-                                      const EigenTensor& rhs) = 0;
+                                      const EigenTensor& rhs,
+                                      FloatType alpha, FloatType beta) = 0;
 
     virtual void permute_assignment_(label_type this_label,
                                      label_type rhs_label,
@@ -217,7 +253,13 @@ protected:
                                          label_type lhs_label,
                                          label_type rhs_label,
                                          const EigenTensor& lhs,
-                                         const EigenTensor& rhs) = 0;
+                                         const EigenTensor& rhs,
+                                         FloatType alpha,
+                                         FloatType beta) = 0;
+
+    virtual void linear_combination_assignment_(
+      label_type this_label, const coefficient_vector& coefficients,
+      const label_vector& labels, const const_tensor_vector& tensors) = 0;
 };
 
 } // namespace tensorwrapper::backends::eigen
@@ -15,15 +15,455 @@
  */
 
 #include "../../buffer/contraction_planner.hpp"
+#include "../../buffer/einsum_planner.hpp"
+#include "../cblas/cblas_gemm.hpp"
+#include "../gett/gett.hpp"
+#include "../permute/permute.hpp"
+#include "../plan_cache.hpp"
+#include "../scratch_arena.hpp"
 #include "eigen_tensor_impl.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <functional>
 #include <iomanip>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <sstream>
+#include <tensorwrapper/backends/gemm_backend.hpp>
+#include <type_traits>
 
 namespace tensorwrapper::backends::eigen {
 
 #define TPARAMS template<typename FloatType, unsigned int Rank>
 #define EIGEN_TENSOR EigenTensorImpl<FloatType, Rank>
 
+namespace {
+
+/// Type used to hold the extents of a tensor
+using extents_type = typename PlanKey::extents_type;
+
+/// The extents of @p t
+template<typename TensorType>
+extents_type extents_of(const TensorType& t) {
+    extents_type rv(t.rank());
+    for(std::size_t i = 0; i < rv.size(); ++i) rv[i] = t.extent(i);
+    return rv;
+}
+
+/// Product of the extents of the modes of a tensor which appear in @p group
+template<typename LabelType>
+std::size_t group_size(const extents_type& t_extents, const LabelType& t_label,
+                       const LabelType& group) {
+    std::size_t rv = 1;
+    for(const auto& x : group) rv *= t_extents[t_label.find(x)[0]];
+    return rv;
+}
+
+/// Evaluates @p expr into @p out, on the thread pool if there is one
+template<typename TensorType, typename ExpressionType>
+void evaluate(TensorType& out, const ExpressionType& expr) {
+    if(const auto ppool = thread_pool())
+        out.device(ppool->device()) = expr;
+    else
+        out = expr;
+}
+
+/** @brief Sums @p in over the modes whose labels do not appear in @p out_label.
+ *
+ *  Modes of @p in which share a label are traversed along their diagonal. The
+ *  result is written to @p out, whose modes are ordered like @p out_label.
+ *  This is done in a single pass over @p in, with the last mode of @p in as
+ *  the inner loop.
+ */
+template<typename FloatType, typename LabelType>
+void trace_into(const EigenTensor<FloatType>& in, const LabelType& in_label,
+                FloatType* out, const LabelType& out_label) {
+    // Unique labels of in, in the order they first appear
+    const auto labels = in_label.intersection(in_label);
+    const auto rank   = labels.size();
+
+    std::vector<std::size_t> extents(rank, 1);
+    std::vector<std::size_t> in_strides(rank, 0);
+    std::vector<std::size_t> out_strides(rank, 0);
+    std::size_t stride = 1;
+    for(std::size_t i = in_label.size(); i-- > 0;) {
+        const auto mode = labels.find(in_label[i])[0];
+        extents[mode]   = in.extent(i);
+        in_strides[mode] += stride;
+        stride *= in.extent(i);
+    }
+    stride = 1;
+    for(std::size_t i = out_label.size(); i-- > 0;) {
+        const auto mode   = labels.find(out_label[i])[0];
+        out_strides[mode] = stride;
+        stride *= extents[mode];
+    }
+    std::fill(out, out + stride, FloatType{0});
+
+    const auto* pin = in.data().data();
+    if(rank == 0) {
+        out[0] = pin[0];
+        return;
+    }
+
+    std::size_t nouter = 1;
+    for(std::size_t i = 0; i + 1 < rank; ++i) nouter *= extents[i];
+    const auto ninner     = extents[rank - 1];
+    const auto in_inner   = in_strides[rank - 1];
+    const auto out_inner  = out_strides[rank - 1];
+    std::size_t in_offset = 0, out_offset = 0;
+    std::vector<std::size_t> index(rank, 0);
+    for(std::size_t n = 0; ninner && n < nouter; ++n) {
+        for(std::size_t j = 0; j < ninner; ++j)
+            out[out_offset + j * out_inner] += pin[in_offset + j * in_inner];
+
+        // Advance the outer modes like an odometer
+        for(std::size_t mode = rank - 1; mode-- > 0;) {
+            in_offset += in_strides[mode];
+            out_offset += out_strides[mode];
+            if(++index[mode] < extents[mode]) break;
+            in_offset -= extents[mode] * in_strides[mode];
+            out_offset -= extents[mode] * out_strides[mode];
+            index[mode] = 0;
+        }
+    }
+}
+
+/** @brief Makes a new tensor by tracing @p in down to the modes in
+ *         @p out_label.
+ *
+ *  The elements of the new tensor live in the calling thread's ScratchArena,
+ *  so the tensor must not outlive the caller's ScratchArena::Scope.
+ */
+template<typename FloatType, typename LabelType>
+auto traced_copy(const EigenTensor<FloatType>& in, const LabelType& in_label,
+                 const LabelType& out_label) {
+    std::vector<std::size_t> extents(out_label.size());
+    for(std::size_t i = 0; i < out_label.size(); ++i)
+        extents[i] = in.extent(in_label.find(out_label[i])[0]);
+    shape::Smooth shape(extents.begin(), extents.end());
+
+    auto buffer = ScratchArena::instance().allocate<FloatType>(shape.size());
+    trace_into(in, in_label, buffer.data(), out_label);
+    return make_eigen_tensor(buffer, shape);
+}
+
+/** @brief An operand of a (batched) GEMM.
+ *
+ *  The operand is a @p rows by @p cols row-major matrix starting at @p data.
+ *  If @p transposed is true the GEMM uses the transpose of that matrix. For a
+ *  batched GEMM the matrices of the batches follow each other in memory.
+ */
+template<typename FloatType>
+struct GemmOperand {
+    const FloatType* data;
+    std::size_t rows;
+    std::size_t cols;
+    bool transposed;
+
+    /// Number of rows of the operand as seen by the GEMM
+    std::size_t gemm_rows() const { return transposed ? cols : rows; }
+
+    /// Number of columns of the operand as seen by the GEMM
+    std::size_t gemm_cols() const { return transposed ? rows : cols; }
+
+    /// The same memory, but used as the transpose by the GEMM
+    GemmOperand transpose() const { return {data, rows, cols, !transposed}; }
+};
+
+/// Computes c = alpha * a * b + beta * c for each of the @p nbatch batches.
+/// Float and double use CBLAS if it is the selected backend, otherwise @p a,
+/// @p b, and @p c are wrapped in Eigen maps. @p c is not read if @p beta is
+/// zero
+template<typename FloatType>
+void gemm(const GemmOperand<FloatType>& a, const GemmOperand<FloatType>& b,
+          FloatType* c, std::size_t nbatch, FloatType alpha, FloatType beta) {
+    constexpr auto e_dyn       = ::Eigen::Dynamic;
+    constexpr auto e_row_major = ::Eigen::RowMajor;
+    using matrix_t    = ::Eigen::Matrix<FloatType, e_dyn, e_dyn, e_row_major>;
+    using map_t       = ::Eigen::Map<matrix_t>;
+    using const_map_t = ::Eigen::Map<const matrix_t>;
+
+    const auto a_stride = a.rows * a.cols;
+    const auto b_stride = b.rows * b.cols;
+    const auto c_rows   = a.gemm_rows();
+    const auto c_cols   = b.gemm_cols();
+
+    // CBLAS only knows about float and double
+    constexpr bool is_blas_type =
+      std::is_same_v<FloatType, float> || std::is_same_v<FloatType, double>;
+    if constexpr(is_blas_type) {
+        if(get_gemm_backend() == GemmBackend::cblas) {
+            const auto k = a.gemm_cols();
+            for(std::size_t i = 0; i < nbatch; ++i)
+                cblas::gemm(a.transposed, b.transposed, c_rows, c_cols, k,
+                            alpha, a.data + i * a_stride, a.cols,
+                            b.data + i * b_stride, b.cols, beta,
+                            c + i * c_rows * c_cols, c_cols);
+            return;
+        }
+    }
+
+    for(std::size_t i = 0; i < nbatch; ++i) {
+        const_map_t amatrix(a.data + i * a_stride, a.rows, a.cols);
+        const_map_t bmatrix(b.data + i * b_stride, b.rows, b.cols);
+        map_t cmatrix(c + i * c_rows * c_cols, c_rows, c_cols);
+
+        // N.b. Eigen folds alpha into its GEMM kernel, i.e., the product is
+        // not scaled in a separate pass
+        auto update = [&cmatrix, alpha, beta](auto&& product) {
+            if(beta == FloatType{0}) {
+                cmatrix.noalias() = alpha * product;
+                return;
+            }
+            if(beta != FloatType{1}) cmatrix *= beta;
+            cmatrix.noalias() += alpha * product;
+        };
+
+        // Eigen recognizes transposed maps and does not copy them
+        if(!a.transposed && !b.transposed) {
+            update(amatrix * bmatrix);
+        } else if(!a.transposed) {
+            update(amatrix * bmatrix.transpose());
+        } else if(!b.transposed) {
+            update(amatrix.transpose() * bmatrix);
+        } else {
+            update(amatrix.transpose() * bmatrix.transpose());
+        }
+    }
+}
+
+/// Mode of @p in_label matching each mode of @p out_label
+template<typename LabelType>
+extents_type mode_map(const LabelType& out_label, const LabelType& in_label) {
+    extents_type rv(out_label.size());
+    for(std::size_t i = 0; i < rv.size(); ++i)
+        rv[i] = in_label.find(out_label[i])[0];
+    return rv;
+}
+
+/// Strides of @p t, ordered so that the i-th is that of mode @p modes[i]
+template<typename TensorType>
+extents_type permuted_strides(const TensorType& t, const extents_type& modes) {
+    const auto t_strides = permute::row_major_strides(extents_of(t));
+    extents_type rv(modes.size());
+    for(std::size_t i = 0; i < rv.size(); ++i) rv[i] = t_strides[modes[i]];
+    return rv;
+}
+
+/** @brief Computes out = op(in...) element-wise with permute::transform.
+ *
+ *  The work is split between the threads of the pool. If @p aliased is true
+ *  the result is computed into a scratch buffer first, since the inputs
+ *  would otherwise be overwritten while still being read.
+ */
+template<typename FloatType, std::size_t NInputs, typename OpType>
+void permuted_transform(const permute::Layout<NInputs>& layout, FloatType* out,
+                        const std::array<const FloatType*, NInputs>& in,
+                        OpType op, bool aliased) {
+    auto pfor = [](std::size_t n, std::size_t elems_per_unit, auto&& fn) {
+        const auto bytes = elems_per_unit * (NInputs + 1) * sizeof(FloatType);
+        parallel_for(n, bytes, fn);
+    };
+    if(!aliased) {
+        permute::transform(layout, out, in, op, pfor);
+        return;
+    }
+
+    std::size_t n = 1;
+    for(auto x : layout.extents) n *= x;
+    ScratchArena::Scope scope;
+    auto buffer = ScratchArena::instance().allocate<FloatType>(n);
+    permute::transform(layout, buffer.data(), in, op, pfor);
+    std::copy(buffer.begin(), buffer.end(), out);
+}
+
+/// Most inputs combined by one pass of a linear combination
+constexpr std::size_t max_linear_inputs = 4;
+
+/// The operation c[0] * x[0] + c[1] * x[1] + ... for permute::transform
+template<typename FloatType, std::size_t... I>
+auto make_linear_op(const std::array<FloatType, sizeof...(I)>& c,
+                    std::index_sequence<I...>) {
+    return [c](const auto&... x) { return ((c[I] * x) + ...); };
+}
+
+/// Computes out = sum_i c[i] * in[i] in one pass, for NInputs inputs
+template<std::size_t NInputs, typename FloatType>
+void linear_pass(const extents_type& extents, FloatType* out,
+                 const std::vector<const FloatType*>& in,
+                 const std::vector<extents_type>& strides,
+                 const std::vector<FloatType>& c) {
+    permute::Layout<NInputs> layout{extents, {}};
+    std::array<const FloatType*, NInputs> pin;
+    std::array<FloatType, NInputs> pc;
+    for(std::size_t i = 0; i < NInputs; ++i) {
+        layout.strides[i] = strides[i];
+        pin[i]            = in[i];
+        pc[i]             = c[i];
+    }
+    auto op = make_linear_op(pc, std::make_index_sequence<NInputs>());
+    permuted_transform(layout, out, pin, op, false);
+}
+
+/// Dispatches to linear_pass based on the number of inputs
+template<typename FloatType>
+void linear_pass(const extents_type& extents, FloatType* out,
+                 const std::vector<const FloatType*>& in,
+                 const std::vector<extents_type>& strides,
+                 const std::vector<FloatType>& c) {
+    static_assert(max_linear_inputs == 4);
+    switch(in.size()) {
+        case 1: linear_pass<1>(extents, out, in, strides, c); break;
+        case 2: linear_pass<2>(extents, out, in, strides, c); break;
+        case 3: linear_pass<3>(extents, out, in, strides, c); break;
+        default: linear_pass<4>(extents, out, in, strides, c); break;
+    }
+}
+
+/// How a GEMM can use a tensor without permuting it
+enum class GemmOrder {
+    /// The modes are grouped as (batch, rows, columns)
+    matrix,
+    /// The modes are grouped as (batch, columns, rows)
+    transposed,
+    /// The tensor has to be permuted first
+    other
+};
+
+/// The GEMM operand for a @p rows by @p cols matrix stored in @p order
+template<typename FloatType>
+GemmOperand<FloatType> make_operand(GemmOrder order, const FloatType* data,
+                                    std::size_t rows, std::size_t cols) {
+    if(order == GemmOrder::transposed) return {data, cols, rows, true};
+    return {data, rows, cols, false};
+}
+
+/** @brief The parts of a contraction which only depend on the labels and the
+ *         extents of the operands.
+ *
+ *  If @p needs_trace is true, the operands first have to be traced down to
+ *  @p lhs_kept and @p rhs_kept and the remaining members are not set.
+ */
+struct ContractionPlan {
+    using label_type = typename PlanKey::label_type;
+
+    bool needs_trace = false;
+    label_type lhs_kept;
+    label_type rhs_kept;
+    bool kept_is_hadamard = false;
+
+    std::size_t nbatch = 0;
+    std::size_t m      = 0;
+    std::size_t n      = 0;
+    std::size_t k      = 0;
+    GemmOrder lhs_order;
+    GemmOrder rhs_order;
+    GemmOrder result_order;
+    gett::ContractionLayout layout;
+};
+
+/// Plans a contraction. @p key holds the labels of the result, the lhs, and
+/// the rhs, followed by the extents of the lhs and the rhs
+ContractionPlan make_contraction_plan(const PlanKey& key) {
+    using label_type        = typename ContractionPlan::label_type;
+    const auto& this_label  = key.labels[0];
+    const auto& lhs_label   = key.labels[1];
+    const auto& rhs_label   = key.labels[2];
+    const auto& lhs_extents = key.extents[0];
+    const auto& rhs_extents = key.extents[1];
+
+    ContractionPlan rv;
+    buffer::EinsumPlanner einsum(this_label, lhs_label, rhs_label);
+
+    // Trace out modes which appear only in one operand (or which are repeated
+    // within an operand) first. What remains is a Hadamard product or a
+    // (batched) contraction.
+    rv.lhs_kept = lhs_label.difference(einsum.lhs_trace());
+    rv.rhs_kept = rhs_label.difference(einsum.rhs_trace());
+    if(rv.lhs_kept != lhs_label || rv.rhs_kept != rhs_label) {
+        rv.needs_trace = true;
+        rv.kept_is_hadamard =
+          this_label.is_hadamard_product(rv.lhs_kept, rv.rhs_kept);
+        return rv;
+    }
+
+    // Indices appearing in all three tensors are batch indices. What remains
+    // is a normal contraction, done once per batch.
+    buffer::ContractionPlanner plan(einsum.result_nonbatch(),
+                                    einsum.lhs_nonbatch(),
+                                    einsum.rhs_nonbatch());
+
+    // The gemm is C(b, m, n) = A(b, m, k) * B(b, k, n)
+    const auto b_labels = einsum.result_batch();
+    const auto m_labels = plan.gemm_row_labels();
+    const auto n_labels = plan.gemm_col_labels();
+    const auto k_labels = plan.gemm_sum_labels();
+    rv.nbatch           = group_size(lhs_extents, lhs_label, b_labels);
+    rv.m                = group_size(lhs_extents, lhs_label, m_labels);
+    rv.n                = group_size(rhs_extents, rhs_label, n_labels);
+    rv.k                = group_size(lhs_extents, lhs_label, k_labels);
+
+    // A GEMM can use a tensor as is if its modes are grouped into batches
+    // followed by rows/columns (in either order)
+    auto gemm_order = [&b_labels](const label_type& t_label,
+                                  const label_type& row_labels,
+                                  const label_type& col_labels) {
+        const auto matrix_labels =
+          b_labels.concatenation(row_labels).concatenation(col_labels);
+        const auto transposed_labels =
+          b_labels.concatenation(col_labels).concatenation(row_labels);
+        if(t_label == matrix_labels) return GemmOrder::matrix;
+        if(t_label == transposed_labels) return GemmOrder::transposed;
+        return GemmOrder::other;
+    };
+    rv.lhs_order    = gemm_order(lhs_label, m_labels, k_labels);
+    rv.rhs_order    = gemm_order(rhs_label, k_labels, n_labels);
+    rv.result_order = gemm_order(this_label, m_labels, n_labels);
+
+    // For GETT, the strides of every mode in the operands and the result
+    auto extent_of = [&](const auto& x) {
+        const auto lhs_modes = lhs_label.find(x);
+        return lhs_modes.empty() ? rhs_extents[rhs_label.find(x)[0]] :
+                                   lhs_extents[lhs_modes[0]];
+    };
+    auto strides = [](const extents_type& extents) {
+        extents_type t_strides(extents.size());
+        std::size_t stride = 1;
+        for(std::size_t i = extents.size(); i-- > 0;) {
+            t_strides[i] = stride;
+            stride *= extents[i];
+        }
+        return t_strides;
+    };
+    extents_type this_extents;
+    for(const auto& x : this_label) this_extents.push_back(extent_of(x));
+    const auto lhs_strides  = strides(lhs_extents);
+    const auto rhs_strides  = strides(rhs_extents);
+    const auto this_strides = strides(this_extents);
+
+    auto stride_of = [](const label_type& t_label,
+                        const extents_type& t_strides,
+                        const auto& x) -> std::size_t {
+        const auto offsets = t_label.find(x);
+        return offsets.empty() ? 0 : t_strides[offsets[0]];
+    };
+    auto add_modes = [&](gett::ModeGroup& group, const label_type& labels) {
+        for(const auto& x : labels)
+            group.add_mode(extent_of(x), stride_of(lhs_label, lhs_strides, x),
+                           stride_of(rhs_label, rhs_strides, x),
+                           stride_of(this_label, this_strides, x));
+    };
+    add_modes(rv.layout.batch, b_labels);
+    add_modes(rv.layout.rows, m_labels);
+    add_modes(rv.layout.cols, n_labels);
+    add_modes(rv.layout.sum, k_labels);
+    return rv;
+}
+
+} // namespace
+
 TPARAMS
 EIGEN_TENSOR::EigenTensorImpl(std::span<value_type> data,
                               const_shape_reference shape) :
@@ -36,7 +476,15 @@ auto EIGEN_TENSOR::permuted_copy_(label_type out, label_type in) const
     std::vector<value_type> buffer(this->size(), value_type{0});
     std::span<value_type> buffer_span(buffer.data(), buffer.size());
 
-    // Make a shape::Smooth object for tensor
+    auto pnew_tensor =
+      std::make_unique<EigenTensorImpl>(buffer_span, permuted_shape_(out, in));
+    pnew_tensor->permute_assignment(out, in, *this);
+    return std::make_pair(std::move(buffer), std::move(pnew_tensor));
+}
+
+TPARAMS
+auto EIGEN_TENSOR::permuted_shape_(label_type out, label_type in) const
+  -> shape_type {
     std::vector<std::size_t> old_shape_vec(this->rank());
     for(std::size_t i = 0; i < old_shape_vec.size(); ++i) {
         old_shape_vec[i] = this->extent(i);
@@ -44,10 +492,37 @@ auto EIGEN_TENSOR::permuted_copy_(label_type out, label_type in) const
     shape_type old_shape(old_shape_vec.begin(), old_shape_vec.end());
     shape_type new_shape(old_shape);
     new_shape(out) = old_shape(in);
-    auto pnew_tensor =
-      std::make_unique<EigenTensorImpl>(buffer_span, new_shape);
-    pnew_tensor->permute_assignment(out, in, *this);
-    return std::make_pair(std::move(buffer), std::move(pnew_tensor));
+    return new_shape;
+}
+
+TPARAMS
+bool EIGEN_TENSOR::is_trace_(const label_type& this_label,
+                             const label_type& rhs_label) const {
+    if(this_label.size() != rhs_label.size()) return true;
+    return rhs_label.has_repeated_indices();
+}
+
+TPARAMS
+bool EIGEN_TENSOR::overlaps_(const value_type* data, size_type n) const {
+    std::less<const value_type*> lt;
+    const value_type* begin = m_tensor_.data();
+    const value_type* end   = begin + m_tensor_.size();
+    return lt(data, end) && lt(begin, data + n);
+}
+
+TPARAMS
+void EIGEN_TENSOR::trace_assignment_(const label_type& this_label,
+                                     const label_type& rhs_label,
+                                     const base_type& rhs) {
+    const auto rhs_data = rhs.data();
+    if(!overlaps_(rhs_data.data(), rhs_data.size())) {
+        trace_into(rhs, rhs_label, m_tensor_.data(), this_label);
+        return;
+    }
+    ScratchArena::Scope scope;
+    auto buffer = ScratchArena::instance().allocate<value_type>(this->size());
+    trace_into(rhs, rhs_label, buffer.data(), this_label);
+    std::copy(buffer.begin(), buffer.end(), m_tensor_.data());
 }
 
 TPARAMS
@@ -90,7 +565,8 @@ void EIGEN_TENSOR::addition_assignment_(label_type this_label,
                                         const base_type& lhs,
                                         const base_type& rhs) {
     auto lambda = [](auto&& lhs, auto&& rhs) { return lhs + rhs; };
-    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs);
+    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs,
+                     FloatType{0});
 }
 
 TPARAMS
@@ -100,7 +576,8 @@ void EIGEN_TENSOR::subtraction_assignment_(label_type this_label,
                                            const base_type& lhs,
                                            const base_type& rhs) {
     auto lambda = [](auto&& lhs, auto&& rhs) { return lhs - rhs; };
-    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs);
+    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs,
+                     FloatType{0});
 }
 
 TPARAMS
@@ -108,29 +585,44 @@ void EIGEN_TENSOR::hadamard_assignment_(label_type this_label,
                                         label_type lhs_label,
                                         label_type rhs_label,
                                         const base_type& lhs,
-                                        const base_type& rhs) {
-    auto lambda = [](auto&& lhs, auto&& rhs) { return lhs * rhs; };
-    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs);
+                                        const base_type& rhs, FloatType alpha,
+                                        FloatType beta) {
+    if(alpha == FloatType{1}) {
+        auto lambda = [](auto&& lhs, auto&& rhs) { return lhs * rhs; };
+        element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs,
+                         beta);
+        return;
+    }
+    auto lambda = [alpha](auto&& lhs, auto&& rhs) { return lhs * rhs * alpha; };
+    element_wise_op_(lambda, this_label, lhs_label, rhs_label, lhs, rhs, beta);
 }
 
 TPARAMS
 void EIGEN_TENSOR::permute_assignment_(label_type this_label,
                                        label_type rhs_label,
                                        const base_type& rhs) {
+    if(is_trace_(this_label, rhs_label)) {
+        trace_assignment_(this_label, rhs_label, rhs);
+        return;
+    }
+
     const auto* rhs_down = dynamic_cast<const my_type*>(&rhs);
 
     if constexpr(Rank <= 1) {
-        m_tensor_ = rhs_down->m_tensor_;
+        evaluate(m_tensor_, rhs_down->m_tensor_);
         return;
     } else {
         if(this_label != rhs_label) { // We need to permute rhs first
-            // Eigen adopts the opposite definition of permutation from us.
-            auto r_to_l = this_label.permutation(rhs_label);
-            // Eigen wants int objects
-            std::vector<int> r_to_l2(r_to_l.begin(), r_to_l.end());
-            m_tensor_ = rhs_down->m_tensor_.shuffle(r_to_l2);
+            const auto rhs_data = rhs.data();
+            const auto pr       = rhs_data.data();
+            const bool aliased  = overlaps_(pr, rhs_data.size());
+            const auto modes    = mode_map(this_label, rhs_label);
+            permute::Layout<1> layout{extents_of(*this),
+                                      {permuted_strides(rhs, modes)}};
+            auto copy = [](const value_type& x) { return x; };
+            permuted_transform(layout, m_tensor_.data(), {pr}, copy, aliased);
         } else {
-            m_tensor_ = rhs_down->m_tensor_;
+            evaluate(m_tensor_, rhs_down->m_tensor_);
         }
     }
 }
@@ -140,19 +632,29 @@ void EIGEN_TENSOR::scalar_multiplication_(label_type this_label,
                                           label_type rhs_label,
                                           FloatType scalar,
                                           const base_type& rhs) {
+    if(is_trace_(this_label, rhs_label)) {
+        trace_assignment_(this_label, rhs_label, rhs);
+        evaluate(m_tensor_, m_tensor_ * scalar);
+        return;
+    }
+
     const auto* rhs_down = dynamic_cast<const my_type*>(&rhs);
 
     if constexpr(Rank <= 1) {
-        m_tensor_ = rhs_down->m_tensor_ * scalar;
+        evaluate(m_tensor_, rhs_down->m_tensor_ * scalar);
         return;
     } else {
         if(this_label != rhs_label) { // We need to permute rhs first
-            auto r_to_l = rhs_label.permutation(this_label);
-            // Eigen wants int objects
-            std::vector<int> r_to_l2(r_to_l.begin(), r_to_l.end());
-            m_tensor_ = rhs_down->m_tensor_.shuffle(r_to_l2) * scalar;
+            const auto rhs_data = rhs.data();
+            const auto pr       = rhs_data.data();
+            const bool aliased  = overlaps_(pr, rhs_data.size());
+            const auto modes    = mode_map(this_label, rhs_label);
+            permute::Layout<1> layout{extents_of(*this),
+                                      {permuted_strides(rhs, modes)}};
+            auto scale = [scalar](const value_type& x) { return x * scalar; };
+            permuted_transform(layout, m_tensor_.data(), {pr}, scale, aliased);
         } else {
-            m_tensor_ = rhs_down->m_tensor_ * scalar;
+            evaluate(m_tensor_, rhs_down->m_tensor_ * scalar);
         }
     }
 }
@@ -162,55 +664,66 @@ template<typename OperationType>
 void EIGEN_TENSOR::element_wise_op_(OperationType op, label_type this_label,
                                     label_type lhs_label, label_type rhs_label,
                                     const base_type& lhs,
-                                    const base_type& rhs) {
+                                    const base_type& rhs, FloatType beta) {
     const auto* lhs_down = dynamic_cast<const my_type*>(&lhs);
     const auto* rhs_down = dynamic_cast<const my_type*>(&rhs);
 
-    // Whose indices match whose?
-    bool this_matches_lhs = (this_label == lhs_label);
-    bool this_matches_rhs = (this_label == rhs_label);
-    bool lhs_matches_rhs  = (lhs_label == rhs_label);
-
-    // The three possible permutations we may need to apply
-    auto get_permutation = [](auto&& lhs_, auto&& rhs_) {
-        auto l_to_r = lhs_.permutation(rhs_);
-        return std::vector<int>(l_to_r.begin(), l_to_r.end());
-    };
-    auto r_to_l    = get_permutation(rhs_label, lhs_label);
-    auto l_to_r    = get_permutation(lhs_label, rhs_label);
-    auto this_to_r = get_permutation(this_label, rhs_label);
-
     auto& lhs_eigen = lhs_down->m_tensor_;
     auto& rhs_eigen = rhs_down->m_tensor_;
 
+    // Each element of *this only depends on the same element of the
+    // operands, so accumulating into *this does not need a scratch buffer
+    auto unpermuted_op = [&]() {
+        if(beta == FloatType{0})
+            evaluate(m_tensor_, op(lhs_eigen, rhs_eigen));
+        else
+            evaluate(m_tensor_, m_tensor_ * beta + op(lhs_eigen, rhs_eigen));
+    };
+
     if constexpr(Rank <= 1) {
-        m_tensor_ = op(lhs_eigen, rhs_eigen);
+        unpermuted_op();
         return;
     } else {
-        if(this_matches_lhs && this_matches_rhs) { // No permutations
-            m_tensor_ = op(lhs_eigen, rhs_eigen);
-        } else if(this_matches_lhs) { // RHS needs permuted
-            m_tensor_ = op(lhs_eigen, rhs_eigen.shuffle(r_to_l));
-        } else if(this_matches_rhs) { // LHS needs permuted
-            m_tensor_ = op(lhs_eigen.shuffle(l_to_r), rhs_eigen);
-        } else if(lhs_matches_rhs) { // This needs permuted
-            m_tensor_ = op(lhs_eigen, rhs_eigen).shuffle(this_to_r);
-        } else { // Everything needs permuted
-            auto lhs_shuffled = lhs_eigen.shuffle(l_to_r);
-            m_tensor_         = op(lhs_shuffled, rhs_eigen).shuffle(this_to_r);
+        // Matching up the modes is cheaper than looking it up in the plan
+        // cache, so element-wise operations are not cached
+        const bool is_permuted = this_label != lhs_label ||
+                                 this_label != rhs_label;
+        if(!is_permuted) {
+            unpermuted_op();
+            return;
         }
-    }
-}
 
-template<typename TensorType>
-auto matrix_size(TensorType&& t, std::size_t row_ranks) {
-    std::size_t nrows = 1;
-    for(std::size_t i = 0; i < row_ranks; ++i) nrows *= t.extent(i);
+        // Permuting the operands is fused into the operation
+        const auto lhs_modes = mode_map(this_label, lhs_label);
+        const auto rhs_modes = mode_map(this_label, rhs_label);
+        const auto lhs_data  = lhs.data();
+        const auto rhs_data  = rhs.data();
+        permute::Layout<2> layout{extents_of(*this),
+                                  {permuted_strides(lhs, lhs_modes),
+                                   permuted_strides(rhs, rhs_modes)}};
+        const bool aliased = overlaps_(lhs_data.data(), lhs_data.size()) ||
+                             overlaps_(rhs_data.data(), rhs_data.size());
+        if(beta == FloatType{0}) {
+            permuted_transform(layout, m_tensor_.data(),
+                               {lhs_data.data(), rhs_data.data()}, op,
+                               aliased);
+            return;
+        }
 
-    std::size_t ncols = 1;
-    const auto rank   = t.rank();
-    for(std::size_t i = row_ranks; i < rank; ++i) ncols *= t.extent(i);
-    return std::make_pair(nrows, ncols);
+        // Accumulating reads *this as a third input
+        const auto pout = m_tensor_.data();
+        permute::Layout<3> acc_layout{
+          layout.extents,
+          {permute::row_major_strides(layout.extents), layout.strides[0],
+           layout.strides[1]}};
+        auto acc_op = [&op, beta](const value_type& o, const value_type& l,
+                                  const value_type& r) {
+            return beta * o + op(l, r);
+        };
+        permuted_transform(acc_layout, pout,
+                           {pout, lhs_data.data(), rhs_data.data()}, acc_op,
+                           aliased);
+    }
 }
 
 TPARAMS
@@ -218,40 +731,167 @@ void EIGEN_TENSOR::contraction_assignment_(label_type this_label,
                                            label_type lhs_label,
                                            label_type rhs_label,
                                            const base_type& lhs,
-                                           const base_type& rhs) {
-    buffer::ContractionPlanner plan(this_label, lhs_label, rhs_label);
-
-    // Transpose, Transpose part of TTGT
-    auto&& [new_lhs_buffer, pnew_lhs_tensor] =
-      lhs.permuted_copy(plan.lhs_permutation(), lhs_label);
-
-    auto&& [new_rhs_buffer, pnew_rhs_tensor] =
-      rhs.permuted_copy(plan.rhs_permutation(), rhs_label);
+                                           const base_type& rhs,
+                                           FloatType alpha, FloatType beta) {
+    // Everything which only depends on the labels and extents is planned once
+    // and reused by later contractions of the same form
+    PlanKey key{typeid(FloatType),
+                {this_label, lhs_label, rhs_label},
+                {extents_of(lhs), extents_of(rhs)}};
+    const auto pplan = PlanCache::instance().get_or_make<ContractionPlan>(
+      std::move(key), make_contraction_plan);
+    const auto& plan = *pplan;
+
+    // Trace out modes which appear only in one operand (or which are repeated
+    // within an operand) first. What remains is a Hadamard product or a
+    // (batched) contraction.
+    if(plan.needs_trace) {
+        const auto& lhs_kept = plan.lhs_kept;
+        const auto& rhs_kept = plan.rhs_kept;
+        ScratchArena::Scope scope;
+        std::unique_ptr<base_type> new_lhs, new_rhs;
+        const base_type* plhs = &lhs;
+        const base_type* prhs = &rhs;
+        if(lhs_kept != lhs_label) {
+            new_lhs = traced_copy(lhs, lhs_label, lhs_kept);
+            plhs    = new_lhs.get();
+        }
+        if(rhs_kept != rhs_label) {
+            new_rhs = traced_copy(rhs, rhs_label, rhs_kept);
+            prhs    = new_rhs.get();
+        }
+        if(plan.kept_is_hadamard)
+            hadamard_assignment_(this_label, lhs_kept, rhs_kept, *plhs, *prhs,
+                                 alpha, beta);
+        else
+            contraction_assignment_(this_label, lhs_kept, rhs_kept, *plhs,
+                                    *prhs, alpha, beta);
+        return;
+    }
 
-    // Gemm part of TTGT
-    auto olabels = plan.result_matrix_labels();
+    // *this can't be written to while it is still being read as an operand
+    const auto lhs_data = lhs.data();
+    const auto rhs_data = rhs.data();
+    const bool aliased  = overlaps_(lhs_data.data(), lhs_data.size()) ||
+                         overlaps_(rhs_data.data(), rhs_data.size());
+
+    // If nothing needs to be transposed, the contraction is just a GEMM.
+    // Modes of *this grouped as (b, n, m) are the transpose of C, i.e.,
+    // B^T * A^T.
+    const bool is_gemm = plan.lhs_order != GemmOrder::other &&
+                         plan.rhs_order != GemmOrder::other &&
+                         plan.result_order != GemmOrder::other;
+    if(is_gemm && !aliased) {
+        const auto a =
+          make_operand(plan.lhs_order, lhs_data.data(), plan.m, plan.k);
+        const auto b =
+          make_operand(plan.rhs_order, rhs_data.data(), plan.k, plan.n);
+        if(plan.result_order == GemmOrder::matrix)
+            gemm(a, b, m_tensor_.data(), plan.nbatch, alpha, beta);
+        else
+            gemm(b.transpose(), a.transpose(), m_tensor_.data(), plan.nbatch,
+                 alpha, beta);
+        return;
+    }
 
-    auto&& [out_buffer, pout_tensor] = this->permuted_copy(olabels, this_label);
+    // Otherwise, rather than the transposes of TTGT, GETT works on the
+    // strided layouts of the operands and *this directly
+    if(!aliased) {
+        gett::contraction(plan.layout, lhs_data.data(), rhs_data.data(),
+                          m_tensor_.data(), alpha, beta);
+        return;
+    }
 
-    const auto [lrows, lcols] =
-      matrix_size(*pnew_lhs_tensor, plan.lhs_free().size());
-    const auto [rrows, rcols] =
-      matrix_size(*pnew_rhs_tensor, plan.rhs_dummy().size());
+    // The contraction overwrites the scratch buffer, so it is never
+    // initialized
+    ScratchArena::Scope scope;
+    const auto out_size = m_tensor_.size();
+    auto out_buffer = ScratchArena::instance().allocate<FloatType>(out_size);
+    gett::contraction(plan.layout, lhs_data.data(), rhs_data.data(),
+                      out_buffer.data(), alpha);
+    if(beta == FloatType{0}) {
+        std::copy(out_buffer.begin(), out_buffer.end(), m_tensor_.data());
+        return;
+    }
+    auto pout = m_tensor_.data();
+    auto axpy = [beta](value_type o, value_type t) { return beta * o + t; };
+    std::transform(pout, pout + out_size, out_buffer.data(), pout, axpy);
+}
 
-    // Work out the types of the matrix amd a map
-    constexpr auto e_dyn       = ::Eigen::Dynamic;
-    constexpr auto e_row_major = ::Eigen::RowMajor;
-    using matrix_t = ::Eigen::Matrix<FloatType, e_dyn, e_dyn, e_row_major>;
-    using map_t    = ::Eigen::Map<matrix_t>;
+TPARAMS
+void EIGEN_TENSOR::linear_combination_assignment_(
+  label_type this_label, const coefficient_vector& coefficients,
+  const label_vector& labels, const const_tensor_vector& tensors) {
+    const auto this_extents = extents_of(*this);
+    const auto this_data    = m_tensor_.data();
+    const auto this_size    = this->size();
+
+    // Terms which are *this itself (same memory, same labels) are folded into
+    // beta, i.e., *this = beta * (*this) + sum of the other terms. Each
+    // element of *this is then read only to compute itself, so the result is
+    // accumulated in place.
+    value_type beta{0};
+    bool has_self = false;
+    std::vector<std::size_t> terms;
+    for(std::size_t i = 0; i < tensors.size(); ++i) {
+        const auto t_data  = tensors[i]->data();
+        const bool is_self = t_data.data() == this_data &&
+                             t_data.size() == this_size &&
+                             labels[i] == this_label;
+        if(is_self) {
+            beta += coefficients[i];
+            has_self = true;
+        } else {
+            terms.push_back(i);
+        }
+    }
 
-    map_t lmatrix(new_lhs_buffer.data(), lrows, lcols);
-    map_t rmatrix(new_rhs_buffer.data(), rrows, rcols);
-    map_t omatrix(out_buffer.data(), lrows, rcols);
+    // Any other term aliasing *this would be read after *this was (partially)
+    // overwritten, so the result is then accumulated in a scratch buffer from
+    // all of the terms
+    bool aliased = false;
+    for(auto i : terms) {
+        const auto t_data = tensors[i]->data();
+        if(overlaps_(t_data.data(), t_data.size())) aliased = true;
+    }
+    ScratchArena::Scope scope;
+    auto& arena     = ScratchArena::instance();
+    value_type* out = this_data;
+    if(aliased) {
+        out      = arena.allocate<value_type>(this_size).data();
+        has_self = false;
+        terms.resize(tensors.size());
+        std::iota(terms.begin(), terms.end(), std::size_t{0});
+    }
 
-    omatrix = lmatrix * rmatrix;
+    // Each pass combines at most max_linear_inputs inputs. Passes after the
+    // first read the partial sum as one of their inputs, as does the first
+    // pass if there is a self term.
+    std::vector<const value_type*> in;
+    std::vector<extents_type> strides;
+    coefficient_vector c;
+    std::size_t next = 0;
+    do {
+        in.clear();
+        strides.clear();
+        c.clear();
+        if(next > 0 || has_self) {
+            in.push_back(out);
+            strides.push_back(permute::row_major_strides(this_extents));
+            c.push_back(next > 0 ? value_type{1} : beta);
+        }
+        for(; next < terms.size() && in.size() < max_linear_inputs; ++next) {
+            const auto i     = terms[next];
+            const auto& t    = *tensors[i];
+            const auto modes = mode_map(this_label, labels[i]);
+            in.push_back(t.data().data());
+            strides.push_back(permuted_strides(t, modes));
+            c.push_back(coefficients[i]);
+        }
+        if(!in.empty()) linear_pass(this_extents, out, in, strides, c);
+    } while(next < terms.size());
 
-    // The last transpose part of TTGT
-    this->permute_assignment(this_label, olabels, *pout_tensor);
+    if(aliased) std::copy(out, out + this_size, this_data);
 }
 
 #undef EIGEN_TENSOR
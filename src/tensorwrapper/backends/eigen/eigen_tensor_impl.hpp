@@ -44,10 +44,13 @@ public:
     ///@{
     using typename base_type::const_reference;
     using typename base_type::const_shape_reference;
+    using typename base_type::coefficient_vector;
     using typename base_type::const_span_type;
+    using typename base_type::const_tensor_vector;
     using typename base_type::eigen_rank_type;
     using typename base_type::index_vector;
     using typename base_type::label_type;
+    using typename base_type::label_vector;
     using typename base_type::permuted_copy_return_type;
     using typename base_type::reference;
     using typename base_type::shape_type;
@@ -106,7 +109,8 @@ protected:
 
     void hadamard_assignment_(label_type this_label, label_type lhs_label,
                               label_type rhs_label, const base_type& lhs,
-                              const base_type& rhs) override;
+                              const base_type& rhs, FloatType alpha,
+                              FloatType beta) override;
 
     void permute_assignment_(label_type this_label, label_type rhs_label,
                              const base_type& rhs) override;
@@ -117,14 +121,35 @@ protected:
 
     void contraction_assignment_(label_type this_labels, label_type lhs_labels,
                                  label_type rhs_labels, const base_type& lhs,
-                                 const base_type& rhs) override;
+                                 const base_type& rhs, FloatType alpha,
+                                 FloatType beta) override;
+
+    void linear_combination_assignment_(
+      label_type this_label, const coefficient_vector& coefficients,
+      const label_vector& labels, const const_tensor_vector& tensors) override;
 
 private:
-    // Code factorization for implementing element-wise operations
+    // Shape of *this after permuting its modes from @p in to @p out
+    shape_type permuted_shape_(label_type out, label_type in) const;
+
+    // True if assigning rhs_label to this_label requires a trace
+    bool is_trace_(const label_type& this_label,
+                   const label_type& rhs_label) const;
+
+    // True if [data, data + n) overlaps the memory *this wraps
+    bool overlaps_(const value_type* data, size_type n) const;
+
+    // Sets *this to the trace of rhs (also handles any permutation)
+    void trace_assignment_(const label_type& this_label,
+                           const label_type& rhs_label, const base_type& rhs);
+
+    // Code factorization for implementing element-wise operations. Computes
+    // *this = op(lhs, rhs) + beta * (*this)
     template<typename OperationType>
     void element_wise_op_(OperationType op, label_type this_label,
                           label_type lhs_label, label_type rhs_label,
-                          const base_type& lhs, const base_type& rhs);
+                          const base_type& lhs, const base_type& rhs,
+                          FloatType beta);
 
     // Handles TMP needed to create an Eigen TensorMap from a Smooth object
     template<std::size_t... I>
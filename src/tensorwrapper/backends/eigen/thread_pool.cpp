@@ -0,0 +1,103 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.hpp"
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <tensorwrapper/backends/num_threads.hpp>
+
+namespace tensorwrapper::backends {
+namespace {
+
+using pool_pointer = std::shared_ptr<const eigen::ThreadPool>;
+
+// Threads are opt-in: each process (e.g., each MPI rank) runs on one thread
+// unless TENSORWRAPPER_NUM_THREADS or set_num_threads says otherwise
+std::size_t default_num_threads() noexcept {
+    const char* env = std::getenv("TENSORWRAPPER_NUM_THREADS");
+    if(env == nullptr) return 1;
+    char* end       = nullptr;
+    const auto n    = std::strtoull(env, &end, 10);
+    const bool good = end != env && *end == '\0' && n > 0;
+    return good ? static_cast<std::size_t>(n) : 1;
+}
+
+// Holds the current pool. Pools are created lazily, so programs which never
+// evaluate a tensor expression never start any threads.
+struct PoolState {
+    std::mutex mutex;
+    std::size_t num_threads = default_num_threads();
+    pool_pointer pool;
+};
+
+PoolState& pool_state_() {
+    static PoolState state;
+    return state;
+}
+
+} // namespace
+
+std::size_t get_num_threads() noexcept {
+    auto& state = pool_state_();
+    std::lock_guard lock(state.mutex);
+    return state.num_threads;
+}
+
+void set_num_threads(std::size_t n) {
+    if(n == 0)
+        throw std::runtime_error("The number of threads must be at least 1.");
+    auto& state = pool_state_();
+    pool_pointer old_pool;
+    std::lock_guard lock(state.mutex);
+    if(n == state.num_threads) return;
+    // The old pool is destroyed (joining its threads) outside of the lock,
+    // once the last operation using it releases it
+    old_pool          = std::move(state.pool);
+    state.num_threads = n;
+}
+
+namespace eigen {
+
+std::shared_ptr<const ThreadPool> thread_pool() noexcept {
+    auto& state = pool_state_();
+    std::lock_guard lock(state.mutex);
+    if(state.num_threads == 1) return nullptr;
+    if(!state.pool) {
+        try {
+            state.pool = std::make_shared<const ThreadPool>(state.num_threads);
+        } catch(...) { return nullptr; } // Fall back to the calling thread
+    }
+    return state.pool;
+}
+
+void parallel_for(std::size_t n, std::size_t bytes_per_unit,
+                  const std::function<void(std::size_t, std::size_t)>& fn) {
+    if(n == 0) return;
+    const auto ppool = thread_pool();
+    if(!ppool || n == 1) {
+        fn(0, n);
+        return;
+    }
+    const Eigen::TensorOpCost cost(bytes_per_unit, 0, 0);
+    auto eigen_fn = [&fn](Eigen::Index first, Eigen::Index last) {
+        fn(first, last);
+    };
+    ppool->device().parallelFor(n, cost, eigen_fn);
+}
+
+} // namespace eigen
+} // namespace tensorwrapper::backends
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace tensorwrapper::backends::eigen {
+
+/** @brief A pool of threads and the Eigen device which runs on it.
+ *
+ *  Eigen expressions are evaluated on the pool with
+ *  `tensor.device(pool.device()) = expression;`.
+ */
+class ThreadPool {
+public:
+    /// Type of the Eigen device
+    using device_type = Eigen::ThreadPoolDevice;
+
+    /// Unsigned integral type used for counting threads
+    using size_type = std::size_t;
+
+    /// Starts @p n threads
+    explicit ThreadPool(size_type n) : m_pool_(n), m_device_(&m_pool_, n) {}
+
+    /// The device to evaluate expressions on
+    const device_type& device() const noexcept { return m_device_; }
+
+private:
+    Eigen::ThreadPool m_pool_;
+    device_type m_device_;
+};
+
+/** @brief Returns the process-wide thread pool.
+ *
+ *  The number of threads is controlled by set_num_threads(). The returned
+ *  pool stays alive for as long as the caller holds onto it, even if the
+ *  number of threads is changed in the meantime.
+ *
+ *  @return The current pool, or nullptr if get_num_threads() is 1 (in which
+ *          case expressions should be evaluated on the default device).
+ *
+ *  @throw None No throw guarantee.
+ */
+std::shared_ptr<const ThreadPool> thread_pool() noexcept;
+
+/** @brief Calls @p fn on disjoint ranges covering [0, @p n).
+ *
+ *  The ranges are spread over the threads of thread_pool(). If there is no
+ *  pool, `fn(0, n)` is called on the calling thread.
+ *
+ *  @param[in] n The number of units of work.
+ *  @param[in] bytes_per_unit About how many bytes a unit reads and writes.
+ *                            Eigen uses this to decide how many units to
+ *                            give each thread.
+ *  @param[in] fn Called as `fn(first, last)` to do units [first, last).
+ *
+ *  @throw None No throw guarantee as long as @p fn does not throw. An
+ *              exception escaping @p fn on one of the pool's threads ends
+ *              the program.
+ */
+void parallel_for(std::size_t n, std::size_t bytes_per_unit,
+                  const std::function<void(std::size_t, std::size_t)>& fn);
+
+} // namespace tensorwrapper::backends::eigen
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <tensorwrapper/backends/gemm_backend.hpp>
+
+namespace tensorwrapper::backends {
+namespace {
+
+auto& gemm_backend_() {
+    static std::atomic<GemmBackend> backend{
+      has_cblas() ? GemmBackend::cblas : GemmBackend::eigen};
+    return backend;
+}
+
+} // namespace
+
+bool has_cblas() noexcept {
+#ifdef ENABLE_CBLAS
+    return true;
+#else
+    return false;
+#endif
+}
+
+GemmBackend get_gemm_backend() noexcept {
+    return gemm_backend_().load(std::memory_order_relaxed);
+}
+
+void set_gemm_backend(GemmBackend backend) {
+    if(backend == GemmBackend::cblas && !has_cblas())
+        throw std::runtime_error(
+          "CBLAS backend not enabled. Recompile with -DENABLE_CBLAS.");
+    gemm_backend_().store(backend, std::memory_order_relaxed);
+}
+
+} // namespace tensorwrapper::backends
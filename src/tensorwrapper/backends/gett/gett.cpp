@@ -0,0 +1,235 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../cblas/cblas_gemm.hpp"
+#include "../eigen/thread_pool.hpp"
+#include "../scratch_arena.hpp"
+#include "gett.hpp"
+#include <algorithm>
+#include <tensorwrapper/backends/gemm_backend.hpp>
+#include <type_traits>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace tensorwrapper::backends::gett {
+namespace {
+
+using size_type   = typename ModeGroup::size_type;
+using size_vector = typename ModeGroup::size_vector;
+
+// Block sizes. A panel of A is at most mc by kc, a panel of B is at most kc by
+// nc, and a tile of C is at most mc by nc.
+constexpr size_type mc = 128;
+constexpr size_type nc = 512;
+constexpr size_type kc = 256;
+
+/** @brief Offsets of every element of a mode group in one of the tensors.
+ *
+ *  The group is traversed in row-major order (last mode fastest). For a group
+ *  with no modes the result is {0}.
+ */
+size_vector offsets(const size_vector& extents, const size_vector& strides) {
+    size_type n = 1;
+    for(auto x : extents) n *= x;
+
+    size_vector rv(n, 0);
+    size_vector index(extents.size(), 0);
+    size_type offset = 0;
+    for(size_type i = 0; i < n; ++i) {
+        rv[i] = offset;
+        for(size_type mode = extents.size(); mode-- > 0;) {
+            offset += strides[mode];
+            if(++index[mode] < extents[mode]) break;
+            offset -= extents[mode] * strides[mode];
+            index[mode] = 0;
+        }
+    }
+    return rv;
+}
+
+/// Stride of the last (fastest) mode of a group, 0 if the group is empty
+size_type inner_stride(const size_vector& strides) {
+    return strides.empty() ? 0 : strides.back();
+}
+
+/** @brief Packs the @p rows by @p cols block of a strided matrix.
+ *
+ *  Element (i, j) of the block lives at `data[row_offsets[i] +
+ *  col_offsets[j]]` and is written to `panel[i * cols + j]`. The loops are
+ *  ordered so that the source is read with the smaller stride.
+ */
+template<typename FloatType>
+void pack(const FloatType* data, const size_type* row_offsets,
+          const size_type* col_offsets, size_type rows, size_type cols,
+          bool rows_fastest, FloatType* panel) {
+    if(rows_fastest) {
+        for(size_type j = 0; j < cols; ++j) {
+            const auto* pcol = data + col_offsets[j];
+            for(size_type i = 0; i < rows; ++i)
+                panel[i * cols + j] = pcol[row_offsets[i]];
+        }
+    } else {
+        for(size_type i = 0; i < rows; ++i) {
+            const auto* prow = data + row_offsets[i];
+            for(size_type j = 0; j < cols; ++j)
+                panel[i * cols + j] = prow[col_offsets[j]];
+        }
+    }
+}
+
+/// Computes tile = a * b (or tile += a * b if @p accumulate is true)
+template<typename FloatType>
+void block_gemm(const FloatType* a, const FloatType* b, FloatType* tile,
+                size_type m, size_type n, size_type k, bool accumulate) {
+    constexpr bool is_blas_type =
+      std::is_same_v<FloatType, float> || std::is_same_v<FloatType, double>;
+    if constexpr(is_blas_type) {
+        if(get_gemm_backend() == GemmBackend::cblas) {
+            const FloatType beta = accumulate ? 1 : 0;
+            cblas::gemm(false, false, m, n, k, FloatType{1}, a, k, b, n, beta,
+                        tile, n);
+            return;
+        }
+    }
+
+    constexpr auto e_dyn       = ::Eigen::Dynamic;
+    constexpr auto e_row_major = ::Eigen::RowMajor;
+    using matrix_t    = ::Eigen::Matrix<FloatType, e_dyn, e_dyn, e_row_major>;
+    using map_t       = ::Eigen::Map<matrix_t>;
+    using const_map_t = ::Eigen::Map<const matrix_t>;
+
+    const_map_t amatrix(a, m, k);
+    const_map_t bmatrix(b, k, n);
+    map_t cmatrix(tile, m, n);
+    if(accumulate)
+        cmatrix.noalias() += amatrix * bmatrix;
+    else
+        cmatrix.noalias() = amatrix * bmatrix;
+}
+
+} // namespace
+
+template<typename FloatType>
+void contraction(const ContractionLayout& layout, const FloatType* a,
+                 const FloatType* b, FloatType* c, FloatType alpha,
+                 FloatType beta) {
+    const auto& batch = layout.batch;
+    const auto& rows  = layout.rows;
+    const auto& cols  = layout.cols;
+    const auto& sum   = layout.sum;
+
+    // Where each batch/row/column/summed index lives in each tensor. These
+    // are O(extent of the group), not O(size of the tensors).
+    const auto batch_a = offsets(batch.extents, batch.a_strides);
+    const auto batch_b = offsets(batch.extents, batch.b_strides);
+    const auto batch_c = offsets(batch.extents, batch.c_strides);
+    const auto rows_a  = offsets(rows.extents, rows.a_strides);
+    const auto rows_c  = offsets(rows.extents, rows.c_strides);
+    const auto cols_b  = offsets(cols.extents, cols.b_strides);
+    const auto cols_c  = offsets(cols.extents, cols.c_strides);
+    const auto sum_a   = offsets(sum.extents, sum.a_strides);
+    const auto sum_b   = offsets(sum.extents, sum.b_strides);
+
+    const auto m = rows_a.size();
+    const auto n = cols_b.size();
+    const auto k = sum_a.size();
+    if(m == 0 || n == 0) return;
+
+    // Pack with whichever index of the panel is closer together in memory
+    const bool a_rows_fastest =
+      inner_stride(rows.a_strides) < inner_stride(sum.a_strides);
+    const bool b_rows_fastest =
+      inner_stride(sum.b_strides) < inner_stride(cols.b_strides);
+    const bool c_rows_fastest =
+      inner_stride(rows.c_strides) < inner_stride(cols.c_strides);
+
+    // Every (batch, row block, column block) tile of C is written by exactly
+    // one unit of work, so the units are spread over the thread pool
+    const auto m_blocks = (m + mc - 1) / mc;
+    const auto n_blocks = (n + nc - 1) / nc;
+    const auto n_units  = batch_a.size() * m_blocks * n_blocks;
+    const auto mt       = std::min(m, mc);
+    const auto nt       = std::min(n, nc);
+    const auto kt       = std::min(k, kc);
+    const auto bytes    = (mt * k + k * nt + 2 * mt * nt) * sizeof(FloatType);
+
+    auto run_units = [&](std::size_t first, std::size_t last) {
+        // Each thread packs into panels from its own arena. The panels and
+        // the tile are always written before they are read, so they come
+        // uninitialized from the arena
+        ScratchArena::Scope scope;
+        auto& arena  = ScratchArena::instance();
+        auto a_panel = arena.allocate<FloatType>(mt * kt);
+        auto b_panel = arena.allocate<FloatType>(kt * nt);
+        auto c_tile  = arena.allocate<FloatType>(mt * nt);
+
+        for(auto unit = first; unit < last; ++unit) {
+            const auto batch_i = unit / (m_blocks * n_blocks);
+            const auto m0      = (unit / n_blocks) % m_blocks * mc;
+            const auto n0      = unit % n_blocks * nc;
+            const auto mb      = std::min(mc, m - m0);
+            const auto nb      = std::min(nc, n - n0);
+            const auto* pa     = a + batch_a[batch_i];
+            const auto* pb     = b + batch_b[batch_i];
+            auto* pc           = c + batch_c[batch_i];
+
+            if(k == 0) std::fill(c_tile.begin(), c_tile.end(), FloatType{0});
+
+            for(size_type k0 = 0; k0 < k; k0 += kc) {
+                const auto kb = std::min(kc, k - k0);
+                pack(pa, rows_a.data() + m0, sum_a.data() + k0, mb, kb,
+                     a_rows_fastest, a_panel.data());
+                pack(pb, sum_b.data() + k0, cols_b.data() + n0, kb, nb,
+                     b_rows_fastest, b_panel.data());
+                block_gemm(a_panel.data(), b_panel.data(), c_tile.data(), mb,
+                           nb, kb, k0 != 0);
+            }
+
+            // Scatter the tile into its place in C. N.b. C is not read when
+            // beta is zero so that its initial contents can be garbage (e.g.,
+            // NaN)
+            auto update = [alpha, beta](FloatType& cij, const FloatType& tij) {
+                if(beta == FloatType{0})
+                    cij = alpha * tij;
+                else
+                    cij = beta * cij + alpha * tij;
+            };
+            if(c_rows_fastest) {
+                for(size_type j = 0; j < nb; ++j) {
+                    auto* pcol = pc + cols_c[n0 + j];
+                    for(size_type i = 0; i < mb; ++i)
+                        update(pcol[rows_c[m0 + i]], c_tile[i * nb + j]);
+                }
+            } else {
+                for(size_type i = 0; i < mb; ++i) {
+                    auto* prow = pc + rows_c[m0 + i];
+                    for(size_type j = 0; j < nb; ++j)
+                        update(prow[cols_c[n0 + j]], c_tile[i * nb + j]);
+                }
+            }
+        }
+    };
+    eigen::parallel_for(n_units, bytes, run_units);
+}
+
+#define DEFINE_GETT_CONTRACTION(TYPE)                                      \
+    template void contraction<TYPE>(const ContractionLayout&, const TYPE*, \
+                                    const TYPE*, TYPE*, TYPE, TYPE)
+
+TW_APPLY_FLOATING_POINT_TYPES(DEFINE_GETT_CONTRACTION);
+
+#undef DEFINE_GETT_CONTRACTION
+
+} // namespace tensorwrapper::backends::gett
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <tensorwrapper/types/floating_point.hpp>
+#include <vector>
+
+namespace tensorwrapper::backends::gett {
+
+/** @brief A set of modes which a contraction treats as a single index.
+ *
+ *  For a contraction C = A * B every mode is a batch mode (appears in A, B,
+ *  and C), a row mode (A and C), a column mode (B and C), or a summed mode
+ *  (A and B). The modes of each kind form a ModeGroup. The i-th mode of the
+ *  group has extent `extents[i]` and is laid out in memory with stride
+ *  `a_strides[i]` in A (likewise for B and C). The stride is 0 for a tensor
+ *  which does not have the mode.
+ *
+ *  The order of the modes within a group does not change the result of the
+ *  contraction, but the last mode of the group is the one traversed
+ *  fastest.
+ */
+struct ModeGroup {
+    /// Unsigned integral type used for extents and strides
+    using size_type = std::size_t;
+
+    /// Type used to hold the extents and strides
+    using size_vector = std::vector<size_type>;
+
+    /// Appends a mode with the provided extent and strides to *this
+    void add_mode(size_type extent, size_type a_stride, size_type b_stride,
+                  size_type c_stride) {
+        extents.push_back(extent);
+        a_strides.push_back(a_stride);
+        b_strides.push_back(b_stride);
+        c_strides.push_back(c_stride);
+    }
+
+    size_vector extents;
+    size_vector a_strides;
+    size_vector b_strides;
+    size_vector c_strides;
+};
+
+/// The modes of a contraction, sorted by kind
+struct ContractionLayout {
+    ModeGroup batch;
+    ModeGroup rows;
+    ModeGroup cols;
+    ModeGroup sum;
+};
+
+/** @brief Computes C = alpha * A * B + beta * C directly from the strided
+ *         layouts of A, B, and C.
+ *
+ *  This is a GETT-style (GEMM-like tensor-tensor) contraction. Rather than
+ *  transposing A, B, and C into matrices (the "TT" and final "T" of TTGT),
+ *  cache-sized blocks of A and B are packed into contiguous panels as they
+ *  are needed. The panels are multiplied with a GEMM and the resulting tile
+ *  is written straight to its (strided) place in C. The extra memory is
+ *  therefore proportional to the block sizes, not to the sizes of the
+ *  tensors.
+ *
+ *  The tiles of C are independent and are spread over the threads of
+ *  eigen::thread_pool(). Each thread packs into panels from its own
+ *  ScratchArena.
+ *
+ *  Each tile of the product is scaled by @p alpha as it is written to C. If
+ *  @p beta is zero the initial contents of @p c are ignored, otherwise the
+ *  scaled tile is added to @p beta times the tile of C it is written to. @p c
+ *  must not alias @p a or @p b.
+ *
+ *  @tparam FloatType The type of the tensor elements.
+ *
+ *  @param[in] layout The modes of the contraction and their strides.
+ *  @param[in] a The first element of A.
+ *  @param[in] b The first element of B.
+ *  @param[in,out] c The first element of C.
+ *  @param[in] alpha The factor to scale the product of A and B by.
+ *  @param[in] beta The factor to scale the initial contents of C by.
+ */
+template<typename FloatType>
+void contraction(const ContractionLayout& layout, const FloatType* a,
+                 const FloatType* b, FloatType* c,
+                 FloatType alpha = FloatType{1},
+                 FloatType beta = FloatType{0});
+
+#define DECLARE_GETT_CONTRACTION(TYPE)                                      \
+    extern template void contraction<TYPE>(const ContractionLayout&,        \
+                                           const TYPE*, const TYPE*, TYPE*, \
+                                           TYPE, TYPE)
+
+TW_APPLY_FLOATING_POINT_TYPES(DECLARE_GETT_CONTRACTION);
+
+#undef DECLARE_GETT_CONTRACTION
+
+} // namespace tensorwrapper::backends::gett
@@ -0,0 +1,259 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace tensorwrapper::backends::permute {
+
+/// Unsigned integral type used for extents and strides
+using size_type = std::size_t;
+
+/// Type used to hold extents and strides
+using size_vector = std::vector<size_type>;
+
+/** @brief How the modes of the result of an element-wise operation are laid
+ *         out in its inputs.
+ *
+ *  The result is row-major with extents @p extents. Mode i of the result is
+ *  laid out with stride `strides[n][i]` in the n-th input. Permuting the
+ *  inputs is thus part of the layout, not a separate step.
+ *
+ *  @tparam NInputs The number of inputs of the operation.
+ */
+template<std::size_t NInputs>
+struct Layout {
+    size_vector extents;
+    std::array<size_vector, NInputs> strides;
+};
+
+/// Strides of a row-major tensor with the provided extents
+inline size_vector row_major_strides(const size_vector& extents) {
+    size_vector rv(extents.size());
+    size_type stride = 1;
+    for(size_type i = extents.size(); i-- > 0;) {
+        rv[i] = stride;
+        stride *= extents[i];
+    }
+    return rv;
+}
+
+namespace detail_ {
+
+/// Number of elements of each mode in a tile. A tile of doubles is 32 KiB.
+constexpr size_type block_size = 64;
+
+/** @brief Removes modes of extent 1 and merges neighboring modes.
+ *
+ *  Modes i and i + 1 of the result are merged if they are also neighbors
+ *  (in the same order) in every input. For example, the permutation
+ *  (0, 2, 1, 3) of a tensor with modes (i, j, k, l) becomes a 2D transpose of
+ *  (j, k) with rows of length l, and no permutation at all becomes a 1D
+ *  copy.
+ */
+template<std::size_t NInputs>
+Layout<NInputs> simplify(const Layout<NInputs>& layout) {
+    Layout<NInputs> rv;
+    for(size_type i = 0; i < layout.extents.size(); ++i) {
+        const auto extent = layout.extents[i];
+        if(extent == 1) continue;
+
+        bool merge = !rv.extents.empty();
+        for(size_type n = 0; merge && n < NInputs; ++n)
+            merge = rv.strides[n].back() == layout.strides[n][i] * extent;
+
+        if(merge) {
+            rv.extents.back() *= extent;
+            for(size_type n = 0; n < NInputs; ++n)
+                rv.strides[n].back() = layout.strides[n][i];
+        } else {
+            rv.extents.push_back(extent);
+            for(size_type n = 0; n < NInputs; ++n)
+                rv.strides[n].push_back(layout.strides[n][i]);
+        }
+    }
+    return rv;
+}
+
+/// Calls op with the j-th element (along strides s) of each input
+template<typename OpType, typename FloatType, std::size_t NInputs,
+         std::size_t... I>
+FloatType apply(OpType& op, const std::array<const FloatType*, NInputs>& p,
+                const std::array<size_type, NInputs>& s, size_type j,
+                std::index_sequence<I...>) {
+    return op(p[I][j * s[I]]...);
+}
+
+/** @brief Computes @p n contiguous elements of the result.
+ *
+ *  The j-th element is computed from element `j * s[i]` of `p[i]`. The
+ *  common case of every input being contiguous is written so that the
+ *  compiler can vectorize it.
+ */
+template<typename OpType, typename FloatType, std::size_t NInputs>
+void row(OpType& op, FloatType* out,
+         const std::array<const FloatType*, NInputs>& p,
+         const std::array<size_type, NInputs>& s, size_type n) {
+    constexpr auto seq = std::make_index_sequence<NInputs>();
+    const bool contiguous =
+      std::all_of(s.begin(), s.end(), [](auto x) { return x == 1; });
+    if(contiguous) {
+        std::array<size_type, NInputs> ones;
+        ones.fill(1);
+        for(size_type j = 0; j < n; ++j) out[j] = apply(op, p, ones, j, seq);
+    } else {
+        for(size_type j = 0; j < n; ++j) out[j] = apply(op, p, s, j, seq);
+    }
+}
+
+} // namespace detail_
+
+/** @brief Computes out = op(in[0], in[1], ...) element by element, permuting
+ *         the inputs as described by @p layout.
+ *
+ *  The result is written in rows along its last (contiguous) mode. If an
+ *  input is not contiguous along that mode, the rows would read that input
+ *  with a large stride. Instead, the result is computed in square tiles
+ *  spanning its last mode and the mode which is contiguous in that input, so
+ *  every cache line of the input which is read is used completely while it
+ *  is still in cache (this is the blocking scheme of HPTT). Permuting and
+ *  combining the inputs happens in this single pass.
+ *
+ *  The work is split into independent units (rows or strips of tiles), which
+ *  are handed to @p parallel_for as `parallel_for(n_units,
+ *  elements_per_unit, fn)`. It must call `fn(first, last)` on disjoint
+ *  ranges covering [0, n_units).
+ *
+ *  @p out must not alias any of the inputs, unless that input has the
+ *  row-major strides of the result. Each element of such an input is read
+ *  only to compute the same element of the result, so `out = op(out, ...)`
+ *  updates @p out in place.
+ *
+ *  @param[in] layout The extents of the result and the strides of the inputs.
+ *  @param[out] out The first element of the result.
+ *  @param[in] in The first element of each input.
+ *  @param[in] op Called with one element of each input to make an element of
+ *                the result.
+ *  @param[in] parallel_for Used to run the units of work.
+ */
+template<std::size_t NInputs, typename FloatType, typename OpType,
+         typename ParallelForType>
+void transform(const Layout<NInputs>& layout, FloatType* out,
+               const std::array<const FloatType*, NInputs>& in, OpType op,
+               ParallelForType&& parallel_for) {
+    constexpr auto bs = detail_::block_size;
+    for(auto x : layout.extents)
+        if(x == 0) return;
+
+    const auto l    = detail_::simplify(layout);
+    const auto rank = l.extents.size();
+    if(rank == 0) {
+        std::array<size_type, NInputs> zeros{};
+        out[0] = detail_::apply(op, in, zeros, 0,
+                                std::make_index_sequence<NInputs>());
+        return;
+    }
+
+    // o is the contiguous mode of the result. If an input is not contiguous
+    // along o, the result is tiled over o and the mode t with the smallest
+    // stride in that input
+    const auto o = rank - 1;
+    auto t       = rank;
+    for(size_type n = 0; n < NInputs && t == rank; ++n) {
+        if(l.strides[n][o] == 1) continue;
+        for(size_type i = 0; i < o; ++i)
+            if(t == rank || l.strides[n][i] < l.strides[n][t]) t = i;
+    }
+    const bool tiled = t != rank;
+
+    const auto out_strides = row_major_strides(l.extents);
+    const auto n_o         = l.extents[o];
+    const auto n_t         = tiled ? l.extents[t] : 1;
+    const auto n_t_blocks  = (n_t + bs - 1) / bs;
+
+    // The modes other than o and t are looped over one index at a time
+    size_vector outer_modes;
+    size_type n_outer = 1;
+    for(size_type i = 0; i < o; ++i) {
+        if(i == t) continue;
+        outer_modes.push_back(i);
+        n_outer *= l.extents[i];
+    }
+
+    std::array<size_type, NInputs> o_strides, t_strides;
+    for(size_type n = 0; n < NInputs; ++n) {
+        o_strides[n] = l.strides[n][o];
+        t_strides[n] = tiled ? l.strides[n][t] : 0;
+    }
+    const auto out_t_stride = tiled ? out_strides[t] : 0;
+
+    // A unit is one index of the outer modes and one block of t
+    auto run_units = [&](size_type first, size_type last) {
+        std::array<const FloatType*, NInputs> p;
+        for(size_type unit = first; unit < last; ++unit) {
+            const auto t0 = (unit % n_t_blocks) * bs;
+            const auto tb = std::min(bs, n_t - t0);
+
+            // Offsets of the first element of the unit
+            auto outer           = unit / n_t_blocks;
+            size_type out_offset = t0 * out_t_stride;
+            std::array<size_type, NInputs> offsets;
+            for(size_type n = 0; n < NInputs; ++n)
+                offsets[n] = t0 * t_strides[n];
+            for(size_type i = outer_modes.size(); i-- > 0;) {
+                const auto mode  = outer_modes[i];
+                const auto index = outer % l.extents[mode];
+                outer /= l.extents[mode];
+                out_offset += index * out_strides[mode];
+                for(size_type n = 0; n < NInputs; ++n)
+                    offsets[n] += index * l.strides[n][mode];
+            }
+
+            if(!tiled) {
+                for(size_type n = 0; n < NInputs; ++n)
+                    p[n] = in[n] + offsets[n];
+                detail_::row(op, out + out_offset, p, o_strides, n_o);
+                continue;
+            }
+
+            for(size_type o0 = 0; o0 < n_o; o0 += bs) {
+                const auto ob = std::min(bs, n_o - o0);
+                for(size_type it = 0; it < tb; ++it) {
+                    for(size_type n = 0; n < NInputs; ++n)
+                        p[n] = in[n] + offsets[n] + it * t_strides[n] +
+                               o0 * o_strides[n];
+                    auto* prow = out + out_offset + it * out_t_stride + o0;
+                    detail_::row(op, prow, p, o_strides, ob);
+                }
+            }
+        }
+    };
+    parallel_for(n_outer * n_t_blocks, n_o * std::min(bs, n_t), run_units);
+}
+
+/// Overload of transform which does all of the work on the calling thread
+template<std::size_t NInputs, typename FloatType, typename OpType>
+void transform(const Layout<NInputs>& layout, FloatType* out,
+               const std::array<const FloatType*, NInputs>& in, OpType op) {
+    auto serial = [](size_type n, size_type, auto&& fn) { fn(0, n); };
+    transform(layout, out, in, std::move(op), serial);
+}
+
+} // namespace tensorwrapper::backends::permute
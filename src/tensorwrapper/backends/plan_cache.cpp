@@ -0,0 +1,92 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plan_cache.hpp"
+#include <boost/container_hash/hash.hpp>
+
+namespace tensorwrapper::backends {
+
+std::size_t PlanKeyHash::operator()(const PlanKey& key) const noexcept {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, key.element_type.hash_code());
+    boost::hash_combine(seed, key.plan_type.hash_code());
+    for(const auto& label : key.labels) {
+        boost::hash_combine(seed, label.size());
+        for(const auto& x : label) boost::hash_combine(seed, x);
+    }
+    for(const auto& extents : key.extents) {
+        boost::hash_combine(seed, extents.size());
+        for(auto x : extents) boost::hash_combine(seed, x);
+    }
+    return seed;
+}
+
+PlanCache& PlanCache::instance() {
+    static PlanCache cache;
+    return cache;
+}
+
+PlanCacheStats PlanCache::stats() const noexcept {
+    PlanCacheStats rv;
+    rv.hits   = m_hits_.load(std::memory_order_relaxed);
+    rv.misses = m_misses_.load(std::memory_order_relaxed);
+    std::lock_guard lock(m_mutex_);
+    rv.size = m_plans_.size();
+    return rv;
+}
+
+void PlanCache::clear() noexcept {
+    std::lock_guard lock(m_mutex_);
+    m_index_.clear();
+    m_plans_.clear();
+    m_hits_.store(0, std::memory_order_relaxed);
+    m_misses_.store(0, std::memory_order_relaxed);
+}
+
+auto PlanCache::find_(const PlanKey& key) -> plan_pointer {
+    auto itr = m_index_.find(key);
+    if(itr == m_index_.end()) return nullptr;
+    m_plans_.splice(m_plans_.begin(), m_plans_, itr->second);
+    return itr->second->second;
+}
+
+auto PlanCache::insert_(PlanKey key, plan_pointer pplan) -> plan_pointer {
+    // Another thread may have added the plan while this one was making it
+    if(auto pold = find_(key)) return pold;
+
+    m_plans_.emplace_front(key, std::move(pplan));
+    try {
+        m_index_.emplace(std::move(key), m_plans_.begin());
+    } catch(...) {
+        m_plans_.pop_front();
+        throw;
+    }
+
+    // Evicting happens last, so a failed insertion does not lose a plan
+    if(m_plans_.size() > max_size()) {
+        m_index_.erase(m_plans_.back().first);
+        m_plans_.pop_back();
+    }
+    return m_plans_.front().second;
+}
+
+PlanCacheStats plan_cache_stats() noexcept {
+    return PlanCache::instance().stats();
+}
+
+void clear_plan_cache() noexcept { PlanCache::instance().clear(); }
+
+} // namespace tensorwrapper::backends
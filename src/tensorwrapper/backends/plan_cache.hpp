@@ -0,0 +1,165 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tensorwrapper/backends/plan_cache_stats.hpp>
+#include <tensorwrapper/dsl/dummy_indices.hpp>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tensorwrapper::backends {
+
+/** @brief What a plan is made from.
+ *
+ *  Two operations with equal keys are planned identically. The key holds the
+ *  labels of the result and of the operands, the extents of the operands,
+ *  and the element type. Which of these a particular kind of plan actually
+ *  depends on is up to the code making the key (e.g., a plan which does not
+ *  depend on the extents can leave them out).
+ */
+struct PlanKey {
+    /// Type of the labels
+    using label_type = dsl::DummyIndices<std::string>;
+
+    /// Type used to hold the extents of a tensor
+    using extents_type = std::vector<std::size_t>;
+
+    /// The type of the tensor elements
+    std::type_index element_type = typeid(void);
+
+    /// The labels of the result followed by those of the operands
+    std::vector<label_type> labels;
+
+    /// The extents of the operands, in the same order as the labels
+    std::vector<extents_type> extents;
+
+    /// The type of the plan. Set by PlanCache, so that kinds of plans made
+    /// from the same inputs do not collide
+    std::type_index plan_type = typeid(void);
+
+    /// Keys are equal if all of their members are equal
+    bool operator==(const PlanKey& rhs) const = default;
+};
+
+/// Hashes a PlanKey so it can be used in an unordered container
+struct PlanKeyHash {
+    std::size_t operator()(const PlanKey& key) const noexcept;
+};
+
+/** @brief Process-wide, thread-safe cache of execution plans.
+ *
+ *  Only plans which are expensive to make (e.g., those of contractions)
+ *  should be cached. For cheap plans the look-up costs more than it saves.
+ *
+ *  Plans are immutable once made and are handed out as shared pointers, so a
+ *  plan stays valid for its users even if it is evicted or the cache is
+ *  cleared. Making a plan happens outside of the lock, so two threads missing
+ *  on the same key at the same time may both make the plan, but only the
+ *  first one is stored.
+ *
+ *  The cache holds at most max_size() plans. Once it is full, adding a plan
+ *  evicts the least recently used one, so plans which are used repeatedly
+ *  stay cached even in programs which make many plans only once.
+ */
+class PlanCache {
+public:
+    /// Type used for counting
+    using size_type = std::size_t;
+
+    /// The cache used by the backends
+    static PlanCache& instance();
+
+    /// Maximum number of plans held at once
+    static constexpr size_type max_size() noexcept { return 1024; }
+
+    /** @brief Returns the plan for @p key, making it if need be.
+     *
+     *  @tparam PlanType The type of the plan.
+     *  @tparam FactoryType A callable which takes a `const PlanKey&` and
+     *                      returns a PlanType object.
+     *
+     *  @param[in] key What the plan is made from.
+     *  @param[in] factory Called with @p key to make the plan if it is not in
+     *                     the cache.
+     *
+     *  @return The plan for @p key.
+     *
+     *  @throw std::bad_alloc if adding the plan fails. Strong throw
+     *                        guarantee.
+     *  @throw ??? Throws whatever @p factory throws. Strong throw guarantee.
+     */
+    template<typename PlanType, typename FactoryType>
+    std::shared_ptr<const PlanType> get_or_make(PlanKey key,
+                                                FactoryType&& factory) {
+        key.plan_type = typeid(PlanType);
+        {
+            std::lock_guard lock(m_mutex_);
+            if(auto pplan = find_(key)) {
+                m_hits_.fetch_add(1, std::memory_order_relaxed);
+                return std::static_pointer_cast<const PlanType>(pplan);
+            }
+        }
+        m_misses_.fetch_add(1, std::memory_order_relaxed);
+
+        auto pplan = std::make_shared<const PlanType>(factory(key));
+        std::lock_guard lock(m_mutex_);
+        return std::static_pointer_cast<const PlanType>(
+          insert_(std::move(key), std::move(pplan)));
+    }
+
+    /// Returns the hit/miss counters and the number of plans
+    PlanCacheStats stats() const noexcept;
+
+    /// Removes all plans and resets the counters
+    void clear() noexcept;
+
+private:
+    /// Type of a plan (type erased, see PlanKey::plan_type)
+    using plan_pointer = std::shared_ptr<const void>;
+
+    /// Type of the list holding the plans, most recently used first
+    using list_type = std::list<std::pair<PlanKey, plan_pointer>>;
+
+    /// Type of the map used to find a plan in the list
+    using map_type =
+      std::unordered_map<PlanKey, typename list_type::iterator, PlanKeyHash>;
+
+    /// Returns the plan for @p key (marking it as most recently used) or a
+    /// nullptr if there is none. Must be called with m_mutex_ held
+    plan_pointer find_(const PlanKey& key);
+
+    /// Adds @p pplan for @p key, evicting the least recently used plan if the
+    /// cache is full, unless there already is a plan for @p key. Returns the
+    /// plan for @p key. Must be called with m_mutex_ held
+    plan_pointer insert_(PlanKey key, plan_pointer pplan);
+
+    mutable std::mutex m_mutex_;
+    list_type m_plans_;
+    map_type m_index_;
+    std::atomic<size_type> m_hits_   = 0;
+    std::atomic<size_type> m_misses_ = 0;
+};
+
+} // namespace tensorwrapper::backends
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scratch_arena.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace tensorwrapper::backends {
+namespace {
+
+// Blocks are never smaller than this, so small requests share a block
+constexpr std::size_t min_block_size = 1 << 16;
+
+} // namespace
+
+ScratchArena& ScratchArena::instance() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+auto ScratchArena::capacity() const noexcept -> size_type {
+    size_type rv = 0;
+    for(const auto& block : m_blocks_) rv += block.size;
+    return rv;
+}
+
+auto ScratchArena::size() const noexcept -> size_type {
+    size_type rv = m_offset_;
+    for(size_type i = 0; i < m_block_ && i < m_blocks_.size(); ++i)
+        rv += m_blocks_[i].size;
+    return rv;
+}
+
+void ScratchArena::release() {
+    if(m_nscopes_ != 0)
+        throw std::runtime_error("Can not release the arena while in use");
+    m_blocks_.clear();
+    m_blocks_.shrink_to_fit();
+    m_block_  = 0;
+    m_offset_ = 0;
+}
+
+auto ScratchArena::make_block_(size_type nbytes) -> Block {
+    auto* p = ::operator new[](nbytes, std::align_val_t{alignment});
+    return Block{decltype(Block::data)(static_cast<std::byte*>(p)), nbytes};
+}
+
+std::byte* ScratchArena::allocate_(size_type nbytes) {
+    if(m_nscopes_ == 0)
+        throw std::runtime_error("Arena memory requires an open Scope");
+
+    // Keep every slice aligned by rounding the requests up
+    nbytes = std::max<size_type>(nbytes, 1);
+    nbytes = (nbytes + alignment - 1) / alignment * alignment;
+
+    // Blocks skipped here stay empty until the enclosing Scope ends
+    for(; m_block_ < m_blocks_.size(); ++m_block_, m_offset_ = 0) {
+        auto& block = m_blocks_[m_block_];
+        if(block.size - m_offset_ >= nbytes) {
+            auto* rv = block.data.get() + m_offset_;
+            m_offset_ += nbytes;
+            return rv;
+        }
+    }
+
+    // Grow geometrically so the number of blocks stays small
+    const auto block_size = std::max({nbytes, capacity(), min_block_size});
+    m_blocks_.push_back(make_block_(block_size));
+    m_block_  = m_blocks_.size() - 1;
+    m_offset_ = nbytes;
+    return m_blocks_.back().data.get();
+}
+
+std::pair<std::size_t, std::size_t> ScratchArena::open_() noexcept {
+    ++m_nscopes_;
+    return {m_block_, m_offset_};
+}
+
+void ScratchArena::close_(std::pair<size_type, size_type> mark) noexcept {
+    m_block_  = mark.first;
+    m_offset_ = mark.second;
+    if(--m_nscopes_ != 0) return;
+
+    // The arena is empty. Memory over the limit is not kept for later
+    const auto total = capacity();
+    if(total > limit()) {
+        release();
+        return;
+    }
+    if(m_blocks_.size() < 2) return;
+
+    // Merge the blocks so that the next operation of this size needs only
+    // one. Freeing first keeps the peak footprint down; if the merged block
+    // can not be had, the arena simply starts over.
+    m_blocks_.clear();
+    try {
+        m_blocks_.push_back(make_block_(total));
+    } catch(...) {}
+}
+
+std::size_t scratch_memory_limit() noexcept { return ScratchArena::limit(); }
+
+void set_scratch_memory_limit(std::size_t nbytes) noexcept {
+    ScratchArena::set_limit(nbytes);
+}
+
+void release_scratch_memory() noexcept {
+    // N.b. user code never runs inside a Scope, so this does not throw
+    auto& arena = ScratchArena::instance();
+    try {
+        arena.release();
+    } catch(...) {}
+}
+
+} // namespace tensorwrapper::backends
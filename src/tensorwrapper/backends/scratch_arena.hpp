@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <tensorwrapper/backends/scratch_memory.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tensorwrapper::backends {
+
+/** @brief Per-thread bump allocator for the temporaries of the backends.
+ *
+ *  Backend operations routinely need scratch memory, e.g., to pack the panels
+ *  of a contraction or to hold a result which aliases one of the operands.
+ *  For large tensors, allocating (and page faulting) a fresh buffer for each
+ *  of these is a measurable fraction of the operation. The arena instead
+ *  hands out slices of blocks of memory which it keeps between operations.
+ *
+ *  Memory may only be requested while a Scope is alive. When a Scope ends,
+ *  everything allocated since it began is released, so scopes must nest
+ *  (which they do naturally as stack objects). When the outermost Scope ends,
+ *  i.e., at the end of each backend operation, the arena is empty. If it
+ *  holds more than limit() bytes its memory is freed. Otherwise, if it
+ *  needed more than one block, its blocks are merged into a single block
+ *  large enough for everything the operation needed. Repeating an operation
+ *  of the same size is then served entirely from memory which has already
+ *  been paged in. The limit is zero (nothing is kept) unless it is raised
+ *  with set_scratch_memory_limit().
+ *
+ *  The memory is uninitialized, so only trivial types may be allocated. Each
+ *  thread has its own arena, so no locking is needed.
+ */
+class ScratchArena {
+public:
+    /// Type used for sizes and offsets
+    using size_type = std::size_t;
+
+    /** @brief Releases the memory allocated while it is alive.
+     *
+     *  Scopes are meant to be stack objects. Each backend operation which
+     *  uses the arena opens one before its first allocation.
+     */
+    class Scope {
+    public:
+        /// Opens a scope of the calling thread's arena
+        Scope() : Scope(ScratchArena::instance()) {}
+
+        /// Opens a scope of @p arena
+        explicit Scope(ScratchArena& arena) noexcept :
+          m_arena_(arena), m_mark_(arena.open_()) {}
+
+        /// Releases everything allocated since *this was made
+        ~Scope() noexcept { m_arena_.close_(m_mark_); }
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        /// The arena *this is a scope of
+        ScratchArena& m_arena_;
+
+        /// Where the arena was when *this was made
+        std::pair<size_type, size_type> m_mark_;
+    };
+
+    /// All allocations are aligned to (at least) this many bytes
+    static constexpr size_type alignment = 64;
+
+    /// The arena of the calling thread
+    static ScratchArena& instance();
+
+    /// The most bytes an arena keeps once its outermost Scope ends
+    static size_type limit() noexcept {
+        return m_limit_.load(std::memory_order_relaxed);
+    }
+
+    /// Sets limit() for the arenas of all threads
+    static void set_limit(size_type nbytes) noexcept {
+        m_limit_.store(nbytes, std::memory_order_relaxed);
+    }
+
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena&)            = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /** @brief Allocates uninitialized memory for @p n objects of type @p T.
+     *
+     *  @tparam T The type of the objects. Must be trivial.
+     *
+     *  @param[in] n The number of objects.
+     *
+     *  @return A view of the memory. It remains valid until the innermost
+     *          Scope which is alive when this is called ends.
+     *
+     *  @throw std::runtime_error if no Scope is alive. Strong throw
+     *                            guarantee.
+     *  @throw std::bad_alloc if a new block is needed and can not be
+     *                        allocated. Strong throw guarantee.
+     */
+    template<typename T>
+    std::span<T> allocate(size_type n) {
+        static_assert(std::is_trivial_v<T>, "Arena memory is uninitialized");
+        static_assert(alignof(T) <= alignment, "Type is over-aligned");
+        auto* p = allocate_(n * sizeof(T));
+        return std::span<T>(reinterpret_cast<T*>(p), n);
+    }
+
+    /// The number of bytes the arena has allocated from the system
+    size_type capacity() const noexcept;
+
+    /// The number of bytes currently handed out (including padding)
+    size_type size() const noexcept;
+
+    /** @brief Returns all of the arena's memory to the system.
+     *
+     *  @throw std::runtime_error if a Scope is alive. Strong throw guarantee.
+     */
+    void release();
+
+private:
+    /// Frees a block with the alignment it was allocated with
+    struct BlockDeleter {
+        void operator()(std::byte* p) const noexcept {
+            ::operator delete[](p, std::align_val_t{alignment});
+        }
+    };
+
+    /// A contiguous chunk of memory the arena hands out slices of
+    struct Block {
+        std::unique_ptr<std::byte[], BlockDeleter> data;
+        size_type size = 0;
+    };
+
+    /// Code factorization for allocating a block of @p nbytes
+    static Block make_block_(size_type nbytes);
+
+    /// Hands out @p nbytes, adding a block if none of them has room
+    std::byte* allocate_(size_type nbytes);
+
+    /// Called when a Scope is made, returns the current position
+    std::pair<size_type, size_type> open_() noexcept;
+
+    /// Called when a Scope ends, rewinds to @p mark
+    void close_(std::pair<size_type, size_type> mark) noexcept;
+
+    /// The memory of the arena
+    std::vector<Block> m_blocks_;
+
+    /// Index of the block allocations are currently taken from
+    size_type m_block_ = 0;
+
+    /// Number of bytes handed out from m_blocks_[m_block_]
+    size_type m_offset_ = 0;
+
+    /// Number of Scopes which are alive
+    size_type m_nscopes_ = 0;
+
+    /// The value of limit(), shared by all arenas
+    static inline std::atomic<size_type> m_limit_ = 0;
+};
+
+} // namespace tensorwrapper::backends
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <tensorwrapper/buffer/allocation_policy.hpp>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace tensorwrapper::buffer {
+namespace {
+
+/// Guards the default policy
+std::mutex& policy_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// The policy returned by default_allocation_policy
+AllocationPolicy& global_policy() {
+    static AllocationPolicy policy;
+    return policy;
+}
+
+#ifdef __linux__
+
+/// Mask of the NUMA nodes, one bit per node
+using node_mask = std::vector<unsigned long>;
+
+/// Number of bits in one word of a node_mask
+constexpr std::size_t bits_per_word = 8 * sizeof(unsigned long);
+
+/** @brief The online NUMA nodes, e.g., "0-1" or "0,2-3", as a mask.
+ *
+ *  The mask is empty if the machine has only one node (or if the nodes can
+ *  not be determined), since there is nothing to interleave over then.
+ */
+node_mask read_online_nodes() {
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string ranges;
+    if(!(file >> ranges)) return {};
+
+    node_mask rv;
+    std::size_t nnodes = 0;
+    std::size_t begin  = 0;
+    while(begin < ranges.size()) {
+        auto end = ranges.find(',', begin);
+        if(end == std::string::npos) end = ranges.size();
+        const auto range = ranges.substr(begin, end - begin);
+        const auto dash  = range.find('-');
+        const auto first = std::stoul(range.substr(0, dash));
+        const auto last  = dash == std::string::npos ?
+                             first :
+                             std::stoul(range.substr(dash + 1));
+        for(auto node = first; node <= last; ++node, ++nnodes) {
+            const auto word = node / bits_per_word;
+            if(word >= rv.size()) rv.resize(word + 1, 0);
+            rv[word] |= 1ul << (node % bits_per_word);
+        }
+        begin = end + 1;
+    }
+    if(nnodes < 2) rv.clear();
+    return rv;
+}
+
+/// The online NUMA nodes, read once
+const node_mask& online_nodes() {
+    static const node_mask nodes = []() {
+        try {
+            return read_online_nodes();
+        } catch(...) { return node_mask{}; }
+    }();
+    return nodes;
+}
+
+#endif
+
+} // namespace
+
+AllocationPolicy default_allocation_policy() noexcept {
+    std::lock_guard lock(policy_mutex());
+    return global_policy();
+}
+
+void set_default_allocation_policy(const AllocationPolicy& policy) noexcept {
+    std::lock_guard lock(policy_mutex());
+    global_policy() = policy;
+}
+
+namespace detail_ {
+
+void apply_allocation_policy(void* data, std::size_t nbytes,
+                             const AllocationPolicy& policy) noexcept {
+    if(data == nullptr || nbytes < policy.min_bytes) return;
+    if(!policy.huge_pages && !policy.numa_interleave) return;
+#ifdef __linux__
+    // The hints work on whole pages, so only the pages which lie entirely
+    // within the allocation are advised
+    const auto page_size = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto address   = reinterpret_cast<std::uintptr_t>(data);
+    const auto begin     = (address + page_size - 1) / page_size * page_size;
+    const auto end       = (address + nbytes) / page_size * page_size;
+    if(end <= begin) return;
+    auto* pbegin      = reinterpret_cast<void*>(begin);
+    const auto length = end - begin;
+
+#ifdef MADV_HUGEPAGE
+    if(policy.huge_pages) madvise(pbegin, length, MADV_HUGEPAGE);
+#endif
+
+#ifdef SYS_mbind
+    // Not every system has libnuma's numaif.h, so the value of
+    // MPOL_INTERLEAVE is spelled out and mbind is called directly
+    constexpr int mpol_interleave = 3;
+    const auto& nodes             = online_nodes();
+    if(policy.numa_interleave && !nodes.empty())
+        syscall(SYS_mbind, pbegin, length, mpol_interleave, nodes.data(),
+                nodes.size() * bits_per_word + 1, 0u);
+#endif
+#endif
+}
+
+} // namespace detail_
+} // namespace tensorwrapper::buffer
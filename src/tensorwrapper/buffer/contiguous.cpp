@@ -16,9 +16,17 @@
 
 #include "../backends/eigen/eigen_tensor_impl.hpp"
 #include "detail_/binary_operation_visitor.hpp"
+#include "detail_/buffer_pool.hpp"
 #include "detail_/hash_utilities.hpp"
+#include "detail_/linear_combination_visitor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <numeric>
+#include <optional>
 #include <tensorwrapper/buffer/contiguous.hpp>
 #include <tensorwrapper/types/floating_point.hpp>
+#include <utility>
 
 namespace tensorwrapper::buffer {
 namespace {
@@ -32,18 +40,202 @@ const Contiguous& downcast(T&& object) {
     }
     return *pobject;
 }
+
+/// A Smooth shape with the extents of @p shape
+shape::Smooth smooth_copy(const shape::ShapeBase& shape) {
+    const auto smooth = shape.as_smooth();
+    std::vector<std::size_t> extents(smooth.rank());
+    for(std::size_t i = 0; i < extents.size(); ++i)
+        extents[i] = smooth.extent(i);
+    return shape::Smooth(extents.begin(), extents.end());
+}
+
+/** @brief Are the bytes [@p a, @p a + @p nbytes) and [@p b, @p b + @p nbytes)
+ *         the same?
+ *
+ *  Large ranges are compared in chunks spread over the thread pool. Chunks
+ *  are skipped once any chunk differs.
+ */
+bool bytes_equal(const std::byte* a, const std::byte* b, std::size_t nbytes) {
+    using detail_::hash_utilities::hash_chunk_bytes;
+    const auto nchunks = (nbytes + hash_chunk_bytes - 1) / hash_chunk_bytes;
+    if(nchunks <= 1) return std::memcmp(a, b, nbytes) == 0;
+
+    std::atomic<bool> equal = true;
+    auto fn = [&](std::size_t first, std::size_t last) {
+        for(auto i = first; i < last; ++i) {
+            if(!equal.load(std::memory_order_relaxed)) return;
+            const auto offset = i * hash_chunk_bytes;
+            const auto n      = std::min(hash_chunk_bytes, nbytes - offset);
+            if(std::memcmp(a + offset, b + offset, n) != 0)
+                equal.store(false, std::memory_order_relaxed);
+        }
+    };
+    backends::eigen::parallel_for(nchunks, 2 * hash_chunk_bytes, fn);
+    return equal.load();
+}
+
+/** @brief Calls @p row_fxn for each row (run of the last mode) of a block.
+ *
+ *  The block has extents @p extents and its modes are laid out with strides
+ *  @p in_strides in @p in and @p out_strides in @p out. For each row
+ *  @p row_fxn is called with pointers to the first element of the row in
+ *  @p in and in @p out, the strides of the row in @p in and in @p out, and
+ *  the length of the row. The rows are spread over the thread pool.
+ */
+template<typename T, typename U, typename RowFxn>
+void for_each_block_row(const T* in, const std::vector<std::size_t>& in_strides,
+                        U* out, const std::vector<std::size_t>& out_strides,
+                        const std::vector<std::size_t>& extents,
+                        RowFxn&& row_fxn) {
+    const auto rank    = extents.size();
+    const auto ncols   = rank ? extents.back() : 1;
+    const auto cstride = rank ? in_strides.back() : 1;
+    const auto ostride = rank ? out_strides.back() : 1;
+    std::size_t nrows  = 1;
+    for(std::size_t i = 0; i + 1 < rank; ++i) nrows *= extents[i];
+    if(nrows * ncols == 0) return;
+
+    auto fn = [&](std::size_t first, std::size_t last) {
+        for(auto row = first; row < last; ++row) {
+            std::size_t in_offset  = 0;
+            std::size_t out_offset = 0;
+            for(std::size_t i = rank - 1, r = row; i-- > 0; r /= extents[i]) {
+                in_offset += (r % extents[i]) * in_strides[i];
+                out_offset += (r % extents[i]) * out_strides[i];
+            }
+            row_fxn(in + in_offset, cstride, out + out_offset, ostride, ncols);
+        }
+    };
+    backends::eigen::parallel_for(nrows, 2 * ncols * sizeof(T), fn);
+}
+
+/// Copies a row of @p ncols elements, strided by @p stride in @p in, to @p out
+/// where they are strided by @p out_stride
+template<typename T>
+void copy_row(const T* in, std::size_t stride, T* out, std::size_t out_stride,
+              std::size_t ncols) {
+    if(stride == 1 && out_stride == 1)
+        std::copy_n(in, ncols, out);
+    else
+        for(std::size_t j = 0; j < ncols; ++j)
+            out[j * out_stride] = in[j * stride];
+}
+
+/// Row-major strides of the modes of an array with extents @p extents
+auto dense_strides(const std::vector<std::size_t>& extents) {
+    std::vector<std::size_t> strides(extents.size());
+    std::size_t stride = 1;
+    for(std::size_t i = extents.size(); i-- > 0;) {
+        strides[i] = stride;
+        stride *= extents[i];
+    }
+    return strides;
+}
+
+/** @brief Copies the block with extents @p extents, whose modes are laid out
+ *         in @p in with strides @p strides, into the dense array @p out.
+ */
+template<typename T>
+void gather_block(const T* in, const std::vector<std::size_t>& extents,
+                  const std::vector<std::size_t>& strides, T* out) {
+    for_each_block_row(in, strides, out, dense_strides(extents), extents,
+                       copy_row<T>);
+}
+
+/** @brief Writes (or, if an alpha is provided, adds alpha times) a block of
+ *         elements into a block of a dense array.
+ *
+ *  The elements of the destination are passed as the first span and those of
+ *  the block as the second, i.e., the argument order wtf's multi-buffer
+ *  visitation uses.
+ */
+class UpdateBlockVisitor {
+public:
+    using size_vector = std::vector<std::size_t>;
+
+    UpdateBlockVisitor(std::size_t out_offset, size_vector out_strides,
+                       std::size_t in_offset, size_vector in_strides,
+                       size_vector extents, std::optional<double> alpha) :
+      m_out_offset_(out_offset),
+      m_out_strides_(std::move(out_strides)),
+      m_in_offset_(in_offset),
+      m_in_strides_(std::move(in_strides)),
+      m_extents_(std::move(extents)),
+      m_alpha_(alpha) {}
+
+    template<typename OutType, typename InType>
+    void operator()(std::span<OutType> out, std::span<const InType> in) const {
+        if constexpr(!std::is_same_v<OutType, InType>) {
+            throw std::runtime_error("The elements of the block and of *this "
+                                     "must be of the same type.");
+        } else {
+            const auto* pin = in.data() + m_in_offset_;
+            auto* pout      = out.data() + m_out_offset_;
+            if(!m_alpha_) {
+                for_each_block_row(pin, m_in_strides_, pout, m_out_strides_,
+                                   m_extents_, copy_row<InType>);
+                return;
+            }
+            const InType alpha(*m_alpha_);
+            auto accumulate_row = [&alpha](const InType* row,
+                                           std::size_t stride, InType* out_row,
+                                           std::size_t out_stride,
+                                           std::size_t n) {
+                for(std::size_t j = 0; j < n; ++j)
+                    out_row[j * out_stride] += alpha * row[j * stride];
+            };
+            for_each_block_row(pin, m_in_strides_, pout, m_out_strides_,
+                               m_extents_, accumulate_row);
+        }
+    }
+
+private:
+    std::size_t m_out_offset_;
+    size_vector m_out_strides_;
+    std::size_t m_in_offset_;
+    size_vector m_in_strides_;
+    size_vector m_extents_;
+    std::optional<double> m_alpha_;
+};
+
 } // namespace
 
 using fp_types = types::floating_point_types;
 
 Contiguous::Contiguous() noexcept = default;
 
+Contiguous::Contiguous(const Contiguous& other) :
+  my_base_type(other),
+  m_recalculate_hash_(other.m_recalculate_hash_),
+  m_hash_caching_(other.m_hash_caching_),
+  m_hash_(other.m_hash_),
+  m_shape_(other.m_shape_),
+  m_buffer_(other.m_buffer_),
+  m_offset_(other.m_offset_),
+  m_strides_(other.m_strides_) {
+    // Elements which may still be modified through a view of other can not
+    // be shared
+    if(other.m_mutable_view_out_ && m_buffer_)
+        m_buffer_ = std::make_shared<buffer_type>(*m_buffer_);
+}
+
+Contiguous& Contiguous::operator=(const Contiguous& other) {
+    if(this != &other) *this = Contiguous(other);
+    return *this;
+}
+
+Contiguous::~Contiguous() noexcept {
+    if(m_buffer_ && m_buffer_.use_count() == 1)
+        detail_::BufferPool::instance().release(std::move(*m_buffer_));
+}
+
 Contiguous::Contiguous(buffer_type buffer, shape_type shape) :
   my_base_type(std::make_unique<layout::Physical>(shape)),
   m_shape_(std::move(shape)),
   m_buffer_() {
     if(buffer.size() == shape.size()) {
-        m_buffer_ = std::move(buffer);
+        m_buffer_ = std::make_shared<buffer_type>(std::move(buffer));
     } else {
         throw std::invalid_argument(
           "The size of the provided buffer does not match the size "
@@ -51,29 +243,92 @@ Contiguous::Contiguous(buffer_type buffer, shape_type shape) :
     }
 }
 
+Contiguous::Contiguous(buffer_type buffer, const layout::Physical& layout) :
+  my_base_type(std::make_unique<layout::Physical>(layout)),
+  m_shape_(smooth_copy(layout.shape())),
+  m_buffer_() {
+    // Dense elements must fill the buffer, the others must fit in it
+    const auto nstorage = layout.storage_size();
+    const bool fits     = layout.is_row_major() ? buffer.size() == nstorage :
+                                                  buffer.size() >= nstorage;
+    if(!fits) {
+        throw std::invalid_argument(
+          "The size of the provided buffer does not match the size "
+          "implied by the provided layout.");
+    }
+    m_buffer_ = std::make_shared<buffer_type>(std::move(buffer));
+    if(!layout.is_row_major()) m_strides_ = layout.strides();
+}
+
+Contiguous::Contiguous(buffer_pointer buffer, shape_type shape,
+                       size_type offset, stride_vector strides) :
+  my_base_type(std::make_unique<layout::Physical>(shape, strides)),
+  m_shape_(std::move(shape)),
+  m_buffer_(std::move(buffer)),
+  m_offset_(offset),
+  m_strides_(std::move(strides)) {}
+
 // -----------------------------------------------------------------------------
 // -- State Accessor
 // -----------------------------------------------------------------------------
 
 auto Contiguous::shape() const -> const_shape_view { return m_shape_; }
 
-auto Contiguous::size() const noexcept -> size_type { return m_buffer_.size(); }
+auto Contiguous::size() const noexcept -> size_type {
+    if(is_strided_()) return m_shape_.size();
+    return m_buffer_ ? m_buffer_->size() : 0;
+}
 
 auto Contiguous::get_mutable_data() -> buffer_view {
     mark_for_rehash_();
-    return m_buffer_;
+    auto& elements      = mutable_elements_();
+    m_mutable_view_out_ = true;
+    return elements;
 }
 
 auto Contiguous::get_immutable_data() const -> const_buffer_view {
-    return m_buffer_;
+    return elements_();
 }
 
 auto Contiguous::infinity_norm() const -> value_type {
-    if(m_buffer_.size() == 0)
+    if(size() == 0)
         throw std::runtime_error(
           "Cannot compute the infinity norm of an empty tensor.");
     detail_::InfinityNormVisitor visitor;
-    return wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, m_buffer_);
+    return wtf::buffer::visit_contiguous_buffer<fp_types>(visitor,
+                                                          *dense_elements_());
+}
+
+// -----------------------------------------------------------------------------
+// -- Block Operations
+// -----------------------------------------------------------------------------
+
+Contiguous Contiguous::copy_block(const index_vector& first_elem,
+                                  const index_vector& last_elem) const {
+    if(last_elem.size() != first_elem.size())
+        throw std::out_of_range("The block's indices differ in length.");
+    index_vector extents(first_elem.size());
+    for(rank_type i = 0; i < first_elem.size(); ++i) {
+        if(last_elem[i] < first_elem[i])
+            throw std::out_of_range("The block's last index precedes its "
+                                    "first index.");
+        extents[i] = last_elem[i] - first_elem[i];
+    }
+    check_block_(first_elem, extents);
+
+    auto rv = alias_(first_elem, last_elem);
+    if(!rv.is_strided_()) return rv;
+    return Contiguous(rv.gather_(), rv.m_shape_);
+}
+
+void Contiguous::assign_block(const index_vector& first_elem,
+                              const Contiguous& block) {
+    update_block_(first_elem, block, std::nullopt);
+}
+
+void Contiguous::accumulate_block(const index_vector& first_elem,
+                                  const Contiguous& block, double alpha) {
+    update_block_(first_elem, block, alpha);
 }
 
 // -----------------------------------------------------------------------------
@@ -81,7 +336,41 @@ auto Contiguous::infinity_norm() const -> value_type {
 // -----------------------------------------------------------------------------
 
 bool Contiguous::operator==(const my_type& rhs) const noexcept {
-    if(!my_base_type::operator==(rhs)) return false;
+    // The objects are compared by value and not by how their elements are
+    // laid out, so the strides of the layouts are not compared
+    if(has_layout() != rhs.has_layout()) return false;
+    if(has_layout()) {
+        const layout::LayoutBase& lhs_layout = layout();
+        if(lhs_layout != rhs.layout()) return false;
+    }
+
+    // Copies which still share their elements are trivially equal
+    const bool same_block =
+      m_offset_ == rhs.m_offset_ && m_strides_ == rhs.m_strides_;
+    if(m_buffer_ == rhs.m_buffer_ && same_block) return true;
+    if(size() != rhs.size()) return false;
+    if(is_strided_() || rhs.is_strided_()) return strided_elements_equal_(rhs);
+
+    // Plain floating-point elements are compared byte by byte, which stops at
+    // the first difference. Otherwise, fall back to comparing hashes.
+    auto lambda = [](const auto& lhs_span, const auto& rhs_span) {
+        using lhs_type = std::decay_t<decltype(lhs_span[0])>;
+        using rhs_type = std::decay_t<decltype(rhs_span[0])>;
+        std::optional<bool> rv;
+        if constexpr(!std::is_same_v<lhs_type, rhs_type>) {
+            rv = false;
+        } else if constexpr(std::is_floating_point_v<lhs_type>) {
+            const auto* a = reinterpret_cast<const std::byte*>(lhs_span.data());
+            const auto* b = reinterpret_cast<const std::byte*>(rhs_span.data());
+            rv            = bytes_equal(a, b, lhs_span.size_bytes());
+        }
+        return rv;
+    };
+    if(size() != 0) {
+        auto is_equal = wtf::buffer::visit_contiguous_buffer<fp_types>(
+          lambda, elements_(), rhs.elements_());
+        if(is_equal.has_value()) return *is_equal;
+    }
     return get_hash_() == rhs.get_hash_();
 }
 
@@ -105,21 +394,28 @@ auto Contiguous::addition_assignment_(label_type this_labels,
     const auto& rhs_down   = downcast(rhs.object());
     const auto& lhs_labels = lhs.labels();
     const auto& rhs_labels = rhs.labels();
-    const auto& lhs_shape  = lhs_down.m_shape_;
-    const auto& rhs_shape  = rhs_down.m_shape_;
+
+    // N.b. the shapes are copied and the elements read first, since *this
+    // may be an operand
+    const auto lhs_shape    = lhs_down.m_shape_;
+    const auto rhs_shape    = rhs_down.m_shape_;
+    const auto lhs_elements = lhs_down.dense_elements_();
+    const auto rhs_elements = rhs_down.dense_elements_();
 
     auto labeled_lhs_shape = lhs_shape(lhs_labels);
     auto labeled_rhs_shape = rhs_shape(rhs_labels);
 
+    my_base_type::addition_assignment_(this_labels, lhs, rhs);
     m_shape_.addition_assignment(this_labels, labeled_lhs_shape,
                                  labeled_rhs_shape);
 
-    detail_::AdditionVisitor visitor(m_buffer_, this_labels, m_shape_,
+    auto& this_buffer = result_elements_(reads_this_(lhs_down, rhs_down));
+    detail_::AdditionVisitor visitor(this_buffer, this_labels, m_shape_,
                                      lhs.labels(), lhs_shape, rhs.labels(),
                                      rhs_shape);
 
-    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, lhs_down.m_buffer_,
-                                                   rhs_down.m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, *lhs_elements,
+                                                   *rhs_elements);
     mark_for_rehash_();
     return *this;
 }
@@ -132,21 +428,28 @@ auto Contiguous::subtraction_assignment_(label_type this_labels,
     const auto& rhs_down   = downcast(rhs.object());
     const auto& lhs_labels = lhs.labels();
     const auto& rhs_labels = rhs.labels();
-    const auto& lhs_shape  = lhs_down.m_shape_;
-    const auto& rhs_shape  = rhs_down.m_shape_;
+
+    // N.b. the shapes are copied and the elements read first, since *this
+    // may be an operand
+    const auto lhs_shape    = lhs_down.m_shape_;
+    const auto rhs_shape    = rhs_down.m_shape_;
+    const auto lhs_elements = lhs_down.dense_elements_();
+    const auto rhs_elements = rhs_down.dense_elements_();
 
     auto labeled_lhs_shape = lhs_shape(lhs_labels);
     auto labeled_rhs_shape = rhs_shape(rhs_labels);
 
+    my_base_type::subtraction_assignment_(this_labels, lhs, rhs);
     m_shape_.subtraction_assignment(this_labels, labeled_lhs_shape,
                                     labeled_rhs_shape);
 
-    detail_::SubtractionVisitor visitor(m_buffer_, this_labels, m_shape_,
+    auto& this_buffer = result_elements_(reads_this_(lhs_down, rhs_down));
+    detail_::SubtractionVisitor visitor(this_buffer, this_labels, m_shape_,
                                         lhs.labels(), lhs_shape, rhs.labels(),
                                         rhs_shape);
 
-    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, lhs_down.m_buffer_,
-                                                   rhs_down.m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, *lhs_elements,
+                                                   *rhs_elements);
     mark_for_rehash_();
     return *this;
 }
@@ -155,23 +458,153 @@ auto Contiguous::multiplication_assignment_(label_type this_labels,
                                             const_labeled_reference lhs,
                                             const_labeled_reference rhs)
   -> dsl_reference {
+    return scaled_multiplication_assignment_(std::move(this_labels), 1.0, lhs,
+                                             rhs);
+}
+
+auto Contiguous::scaled_multiplication_assignment_(
+  label_type this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) -> dsl_reference {
     const auto& lhs_down  = downcast(lhs.object());
     const auto& rhs_down  = downcast(rhs.object());
-    const auto& lhs_shape = lhs_down.m_shape_;
-    const auto& rhs_shape = rhs_down.m_shape_;
+    const bool reads_this = reads_this_(lhs_down, rhs_down);
+
+    // N.b. the shapes are copied, and if *this is an operand the elements
+    // are read, before *this changes
+    const auto lhs_shape = lhs_down.m_shape_;
+    const auto rhs_shape = rhs_down.m_shape_;
+    const_buffer_pointer lhs_elements, rhs_elements;
+    if(reads_this) {
+        lhs_elements = lhs_down.dense_elements_();
+        rhs_elements = rhs_down.dense_elements_();
+    }
 
     auto labeled_lhs_shape = lhs_shape(lhs.labels());
     auto labeled_rhs_shape = rhs_shape(rhs.labels());
 
+    my_base_type::multiplication_assignment_(this_labels, lhs, rhs);
     m_shape_.multiplication_assignment(this_labels, labeled_lhs_shape,
                                        labeled_rhs_shape);
 
-    detail_::MultiplicationVisitor visitor(m_buffer_, this_labels, m_shape_,
+    auto& this_buffer = result_elements_(reads_this);
+
+    // Slices are contracted where they are, rather than copied first
+    if(!reads_this && (lhs_down.is_strided_() || rhs_down.is_strided_())) {
+        // Operands which merely store their modes in another order (e.g., as
+        // chosen by layout::Converter) are relabeled, which keeps GEMM usable
+        const auto dense_lhs = lhs_down.as_dense_(lhs.labels());
+        const auto dense_rhs = rhs_down.as_dense_(rhs.labels());
+        if(dense_lhs && dense_rhs) {
+            detail_::MultiplicationVisitor visitor(
+              this_buffer, this_labels, m_shape_, dense_lhs->first,
+              dense_lhs->second, dense_rhs->first, dense_rhs->second, alpha);
+            wtf::buffer::visit_contiguous_buffer<fp_types>(
+              visitor, std::as_const(*lhs_down.m_buffer_),
+              std::as_const(*rhs_down.m_buffer_));
+            mark_for_rehash_();
+            return *this;
+        }
+
+        detail_::StridedContractionVisitor strided_visitor(
+          this_buffer, this_labels, m_shape_, lhs.labels(), lhs_shape,
+          {lhs_down.m_offset_, lhs_down.strides_()}, rhs.labels(), rhs_shape,
+          {rhs_down.m_offset_, rhs_down.strides_()}, alpha);
+        if(strided_visitor.is_contraction()) {
+            wtf::buffer::visit_contiguous_buffer<fp_types>(
+              strided_visitor, std::as_const(*lhs_down.m_buffer_),
+              std::as_const(*rhs_down.m_buffer_));
+            mark_for_rehash_();
+            return *this;
+        }
+    }
+
+    if(!reads_this) {
+        lhs_elements = lhs_down.dense_elements_();
+        rhs_elements = rhs_down.dense_elements_();
+    }
+    detail_::MultiplicationVisitor visitor(this_buffer, this_labels, m_shape_,
+                                           lhs.labels(), lhs_shape,
+                                           rhs.labels(), rhs_shape, alpha);
+
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, *lhs_elements,
+                                                   *rhs_elements);
+
+    mark_for_rehash_();
+    return *this;
+}
+
+auto Contiguous::multiplication_accumulation_(label_type this_labels,
+                                              double alpha,
+                                              const_labeled_reference lhs,
+                                              const_labeled_reference rhs)
+  -> dsl_reference {
+    const auto& lhs_down  = downcast(lhs.object());
+    const auto& rhs_down  = downcast(rhs.object());
+    const auto& lhs_shape = lhs_down.m_shape_;
+    const auto& rhs_shape = rhs_down.m_shape_;
+
+    auto labeled_lhs_shape = lhs_shape(lhs.labels());
+    auto labeled_rhs_shape = rhs_shape(rhs.labels());
+
+    // The product is added to the elements of *this, so neither the shape nor
+    // the layout of *this change
+    shape_type product_shape;
+    product_shape.multiplication_assignment(this_labels, labeled_lhs_shape,
+                                            labeled_rhs_shape);
+    if(product_shape != m_shape_)
+        throw std::runtime_error(
+          "Shape of the product is not the shape of the buffer");
+
+    // Elements of *this which are not dense keep their layout, so the product
+    // is formed on its own and then added to them
+    if(is_strided_()) {
+        Contiguous product;
+        product.scaled_multiplication_assignment_(this_labels, alpha, lhs,
+                                                  rhs);
+        update_block_(index_vector(m_shape_.rank(), 0), product, 1.0);
+        return *this;
+    }
+
+    auto& this_buffer     = mutable_elements_();
+    const bool reads_this = reads_this_(lhs_down, rhs_down);
+
+    // Slices are contracted where they are, rather than copied first
+    if(!reads_this && (lhs_down.is_strided_() || rhs_down.is_strided_())) {
+        // Operands which merely store their modes in another order (e.g., as
+        // chosen by layout::Converter) are relabeled, which keeps GEMM usable
+        const auto dense_lhs = lhs_down.as_dense_(lhs.labels());
+        const auto dense_rhs = rhs_down.as_dense_(rhs.labels());
+        if(dense_lhs && dense_rhs) {
+            detail_::MultiplicationVisitor visitor(
+              this_buffer, this_labels, m_shape_, dense_lhs->first,
+              dense_lhs->second, dense_rhs->first, dense_rhs->second, alpha,
+              1.0);
+            wtf::buffer::visit_contiguous_buffer<fp_types>(
+              visitor, std::as_const(*lhs_down.m_buffer_),
+              std::as_const(*rhs_down.m_buffer_));
+            mark_for_rehash_();
+            return *this;
+        }
+
+        detail_::StridedContractionVisitor strided_visitor(
+          this_buffer, this_labels, m_shape_, lhs.labels(), lhs_shape,
+          {lhs_down.m_offset_, lhs_down.strides_()}, rhs.labels(), rhs_shape,
+          {rhs_down.m_offset_, rhs_down.strides_()}, alpha, 1.0);
+        if(strided_visitor.is_contraction()) {
+            wtf::buffer::visit_contiguous_buffer<fp_types>(
+              strided_visitor, std::as_const(*lhs_down.m_buffer_),
+              std::as_const(*rhs_down.m_buffer_));
+            mark_for_rehash_();
+            return *this;
+        }
+    }
+
+    detail_::MultiplicationVisitor visitor(this_buffer, this_labels, m_shape_,
                                            lhs.labels(), lhs_shape,
-                                           rhs.labels(), rhs_shape);
+                                           rhs.labels(), rhs_shape, alpha, 1.0);
 
-    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, lhs_down.m_buffer_,
-                                                   rhs_down.m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(
+      visitor, *lhs_down.dense_elements_(), *rhs_down.dense_elements_());
 
     mark_for_rehash_();
     return *this;
@@ -182,16 +615,19 @@ auto Contiguous::permute_assignment_(label_type this_labels,
   -> dsl_reference {
     const auto& rhs_down   = downcast(rhs.object());
     const auto& rhs_labels = rhs.labels();
-    const auto& rhs_shape  = rhs_down.m_shape_;
+    const auto rhs_shape   = rhs_down.m_shape_; // *this may be rhs
+    const auto rhs_elements = rhs_down.dense_elements_();
 
     auto labeled_rhs_shape = rhs_shape(rhs_labels);
 
+    my_base_type::permute_assignment_(this_labels, rhs);
     m_shape_.permute_assignment(this_labels, labeled_rhs_shape);
 
-    detail_::PermuteVisitor visitor(m_buffer_, this_labels, m_shape_,
+    auto& this_buffer = result_elements_(reads_this_(rhs_down));
+    detail_::PermuteVisitor visitor(this_buffer, this_labels, m_shape_,
                                     rhs.labels(), rhs_shape);
 
-    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, rhs_down.m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, *rhs_elements);
     mark_for_rehash_();
     return *this;
 }
@@ -201,16 +637,54 @@ auto Contiguous::scalar_multiplication_(label_type this_labels, double scalar,
   -> dsl_reference {
     const auto& rhs_down   = downcast(rhs.object());
     const auto& rhs_labels = rhs.labels();
-    const auto& rhs_shape  = rhs_down.m_shape_;
+    const auto rhs_shape   = rhs_down.m_shape_; // *this may be rhs
+    const auto rhs_elements = rhs_down.dense_elements_();
 
     auto labeled_rhs_shape = rhs_shape(rhs_labels);
 
+    my_base_type::permute_assignment_(this_labels, rhs);
     m_shape_.permute_assignment(this_labels, labeled_rhs_shape);
 
+    auto& this_buffer = result_elements_(reads_this_(rhs_down));
     detail_::ScalarMultiplicationVisitor visitor(
-      m_buffer_, this_labels, m_shape_, rhs.labels(), rhs_shape, scalar);
+      this_buffer, this_labels, m_shape_, rhs.labels(), rhs_shape, scalar);
 
-    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, rhs_down.m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, *rhs_elements);
+    mark_for_rehash_();
+    return *this;
+}
+
+auto Contiguous::linear_combination_assignment_(label_type this_labels,
+                                                const linear_terms_type& terms)
+  -> dsl_reference {
+    // N.b. the terms are recorded before *this changes, since *this may be
+    // one of them
+    detail_::LinearCombinationVisitor::term_vector visitor_terms;
+    bool reads_this = false;
+    for(const auto& [coefficient, term] : terms) {
+        const auto& term_down = downcast(term.object());
+        visitor_terms.push_back({coefficient, term.labels(),
+                                 term_down.m_shape_,
+                                 term_down.dense_elements_()});
+        reads_this = reads_this || reads_this_(term_down);
+    }
+
+    const auto& first_term     = terms.front().second;
+    const auto& first_shape    = visitor_terms.front().shape;
+    const auto& first_elements = *visitor_terms.front().elements;
+
+    auto labeled_first_shape = first_shape(first_term.labels());
+
+    // The base class ensured the terms are all permutations of the result
+    my_base_type::permute_assignment_(this_labels, first_term);
+    m_shape_.permute_assignment(this_labels, labeled_first_shape);
+
+    auto& this_buffer = result_elements_(reads_this);
+    detail_::LinearCombinationVisitor visitor(this_buffer, this_labels,
+                                              m_shape_,
+                                              std::move(visitor_terms));
+
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, first_elements);
     mark_for_rehash_();
     return *this;
 }
@@ -238,7 +712,7 @@ std::ostream& Contiguous::add_to_stream_(std::ostream& os) const {
     /// XXX: EigenTensor should handle aliasing a const buffer correctly. That's
     ///      a lot of work, just to get this to work though...
 
-    if(m_buffer_.size() == 0) return os;
+    if(size() == 0) return os;
     auto lambda = [&](auto&& span) {
         using clean_type = std::decay_t<decltype(span)>::value_type;
         auto data_ptr    = const_cast<clean_type*>(span.data());
@@ -246,20 +720,20 @@ std::ostream& Contiguous::add_to_stream_(std::ostream& os) const {
         auto ptensor = backends::eigen::make_eigen_tensor(data_span, m_shape_);
         ptensor->add_to_stream(os);
     };
-    wtf::buffer::visit_contiguous_buffer<fp_types>(lambda, m_buffer_);
+    wtf::buffer::visit_contiguous_buffer<fp_types>(lambda, *dense_elements_());
     return os;
 }
 
 auto Contiguous::get_elem_(index_vector index) const
   -> const_element_reference {
     auto ordinal_index = coordinate_to_ordinal_(index);
-    return m_buffer_.at(ordinal_index);
+    return elements_().at(ordinal_index);
 }
 
 void Contiguous::set_elem_(index_vector index, element_type new_value) {
     auto ordinal_index = coordinate_to_ordinal_(index);
     mark_for_rehash_();
-    m_buffer_.at(ordinal_index) = new_value;
+    mutable_elements_().at(ordinal_index) = new_value;
 }
 
 auto Contiguous::slice_(index_vector first_elem, index_vector last_elem)
@@ -276,6 +750,165 @@ auto Contiguous::slice_(index_vector first_elem, index_vector last_elem) const
 // -- Private Methods
 // -----------------------------------------------------------------------------
 
+auto Contiguous::elements_() const -> const buffer_type& {
+    static const buffer_type empty;
+    return m_buffer_ ? *m_buffer_ : empty;
+}
+
+auto Contiguous::dense_elements_() const -> const_buffer_pointer {
+    if(is_strided_()) return std::make_shared<const buffer_type>(gather_());
+    // N.b. aliases no owner, so the use count of m_buffer_ is unchanged
+    return const_buffer_pointer(const_buffer_pointer{}, &elements_());
+}
+
+auto Contiguous::mutable_elements_() -> buffer_type& {
+    // N.b. no views of new elements have been handed out yet
+    if(!m_buffer_) {
+        m_buffer_           = std::make_shared<buffer_type>();
+        m_mutable_view_out_ = false;
+    } else if(m_buffer_.use_count() > 1) { // Copy-on-write
+        m_buffer_           = std::make_shared<buffer_type>(*m_buffer_);
+        m_mutable_view_out_ = false;
+    }
+    return *m_buffer_;
+}
+
+auto Contiguous::result_elements_(bool reads_this) -> buffer_type& {
+    // The old elements are about to be overwritten, so copying them would be
+    // wasted work unless the operation reads them too. Operations read a dense
+    // copy of strided elements, so those are never reused. N.b. the layout of
+    // *this was already made row-major by the operation.
+    const bool is_shared = m_buffer_.use_count() > 1;
+    if(m_buffer_ && (is_strided_() || (is_shared && !reads_this))) {
+        m_buffer_           = std::make_shared<buffer_type>();
+        m_offset_           = 0;
+        m_mutable_view_out_ = false;
+        m_strides_.clear();
+    }
+    return mutable_elements_();
+}
+
+auto Contiguous::alias_(const index_vector& first_elem,
+                        const index_vector& last_elem) const -> Contiguous {
+    auto strides    = strides_();
+    auto offset     = m_offset_;
+    const auto rank = m_shape_.rank();
+    bool is_whole   = true;
+    index_vector extents(rank);
+    for(rank_type i = 0; i < rank; ++i) {
+        offset += first_elem[i] * strides[i];
+        extents[i] = last_elem[i] - first_elem[i];
+        is_whole   = is_whole && extents[i] == m_shape_.extent(i);
+    }
+    if(is_whole) return *this;
+    shape_type shape(extents.begin(), extents.end());
+    return Contiguous(m_buffer_, std::move(shape), offset, std::move(strides));
+}
+
+auto Contiguous::strides_() const -> stride_vector {
+    if(is_strided_()) return m_strides_;
+    stride_vector strides(m_shape_.rank());
+    size_type stride = 1;
+    for(rank_type i = m_shape_.rank(); i-- > 0;) {
+        strides[i] = stride;
+        stride *= m_shape_.extent(i);
+    }
+    return strides;
+}
+
+auto Contiguous::as_dense_(const label_type& labels) const
+  -> std::optional<std::pair<label_type, shape_type>> {
+    if(!is_strided_()) return std::make_pair(labels, m_shape_);
+    if(m_offset_ != 0 || m_buffer_->size() != m_shape_.size())
+        return std::nullopt;
+
+    // Sort the modes from the slowest to the fastest varying, then check that
+    // they are dense in that order
+    const auto rank = m_shape_.rank();
+    std::vector<rank_type> order(rank);
+    std::iota(order.begin(), order.end(), rank_type{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [this](rank_type a, rank_type b) {
+                         return m_strides_[a] > m_strides_[b];
+                     });
+
+    typename label_type::split_string_type dense_labels(rank);
+    stride_vector extents(rank);
+    size_type stride = 1;
+    for(rank_type i = rank; i-- > 0;) {
+        const auto mode = order[i];
+        if(m_strides_[mode] != stride) return std::nullopt;
+        dense_labels[i] = labels.at(mode);
+        extents[i]      = m_shape_.extent(mode);
+        stride *= extents[i];
+    }
+    return std::make_pair(label_type(std::move(dense_labels)),
+                          shape_type(extents.begin(), extents.end()));
+}
+
+auto Contiguous::gather_() const -> buffer_type {
+    const auto rank = m_shape_.rank();
+    stride_vector extents(rank);
+    for(rank_type i = 0; i < rank; ++i) extents[i] = m_shape_.extent(i);
+    const auto strides = strides_();
+
+    auto lambda = [&](const auto& span) {
+        using value_type = std::decay_t<decltype(span[0])>;
+        auto elements    = make_elements(m_shape_.size(), value_type{});
+        gather_block(span.data() + m_offset_, extents, strides,
+                     elements.data());
+        return buffer_type(std::move(elements));
+    };
+    return wtf::buffer::visit_contiguous_buffer<fp_types>(lambda, elements_());
+}
+
+bool Contiguous::strided_elements_equal_(const my_type& rhs) const noexcept {
+    if(m_shape_.size() == 0) return true;
+
+    // Offset of the n-th element (in row-major order) of c in *c.m_buffer_
+    const auto rank = m_shape_.rank();
+    auto ordinal    = [rank](const Contiguous& c, size_type n) {
+        auto rv                = c.m_offset_;
+        size_type dense_stride = 1;
+        for(rank_type i = rank; i-- > 0;) {
+            const auto extent = c.m_shape_.extent(i);
+            const auto stride =
+              c.is_strided_() ? c.m_strides_[i] : dense_stride;
+            rv += (n % extent) * stride;
+            n /= extent;
+            dense_stride *= extent;
+        }
+        return rv;
+    };
+
+    auto lambda = [&](const auto& lhs_span, const auto& rhs_span) {
+        using lhs_type = std::decay_t<decltype(lhs_span[0])>;
+        using rhs_type = std::decay_t<decltype(rhs_span[0])>;
+        if constexpr(!std::is_same_v<lhs_type, rhs_type>) {
+            return false;
+        } else {
+            using detail_::hash_utilities::hash_input;
+            using detail_::hash_utilities::hash_type;
+            for(size_type n = 0; n < m_shape_.size(); ++n) {
+                const auto& a = lhs_span[ordinal(*this, n)];
+                const auto& b = rhs_span[ordinal(rhs, n)];
+                if constexpr(std::is_floating_point_v<lhs_type>) {
+                    if(std::memcmp(&a, &b, sizeof(a)) != 0) return false;
+                } else {
+                    hash_type a_hash = 0;
+                    hash_type b_hash = 0;
+                    hash_input(a_hash, a);
+                    hash_input(b_hash, b);
+                    if(a_hash != b_hash) return false;
+                }
+            }
+            return true;
+        }
+    };
+    return wtf::buffer::visit_contiguous_buffer<fp_types>(lambda, elements_(),
+                                                          rhs.elements_());
+}
+
 void Contiguous::check_index_(const index_vector& index) const {
     if(index.size() != m_shape_.rank()) {
         throw std::out_of_range(
@@ -291,8 +924,60 @@ void Contiguous::check_index_(const index_vector& index) const {
     }
 }
 
+void Contiguous::check_block_(const index_vector& first_elem,
+                              const index_vector& extents) const {
+    const auto rank = m_shape_.rank();
+    if(first_elem.size() != rank || extents.size() != rank)
+        throw std::out_of_range(
+          "The rank of the block does not match the rank of *this.");
+    for(rank_type i = 0; i < rank; ++i) {
+        if(first_elem[i] + extents[i] > m_shape_.extent(i))
+            throw std::out_of_range(
+              "The block extends past the end of the corresponding "
+              "dimension.");
+    }
+}
+
+void Contiguous::update_block_(const index_vector& first_elem,
+                               const Contiguous& block,
+                               std::optional<double> alpha) {
+    const auto rank = block.m_shape_.rank();
+    index_vector extents(rank);
+    for(rank_type i = 0; i < rank; ++i) extents[i] = block.m_shape_.extent(i);
+    check_block_(first_elem, extents);
+    if(&block == this && !alpha) return;
+
+    // N.b. block may alias the elements of *this, so its layout is captured
+    // before mutable_elements_ (possibly) gives *this new elements
+    auto block_buffer = block.m_buffer_;
+    if(!block_buffer) return;
+    const auto block_offset = block.m_offset_;
+    auto block_strides      = block.strides_();
+
+    auto& this_buffer = mutable_elements_();
+    auto this_strides = strides_();
+    auto offset       = m_offset_;
+    for(rank_type i = 0; i < rank; ++i)
+        offset += first_elem[i] * this_strides[i];
+
+    UpdateBlockVisitor visitor(offset, std::move(this_strides), block_offset,
+                               std::move(block_strides), std::move(extents),
+                               alpha);
+    const auto& block_elements = *block_buffer;
+    wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, this_buffer,
+                                                   block_elements);
+    mark_for_rehash_();
+}
+
 auto Contiguous::coordinate_to_ordinal_(index_vector index) const -> size_type {
     check_index_(index);
+    // Strided elements are found where they are stored
+    if(is_strided_()) {
+        auto ordinal = m_offset_;
+        for(rank_type i = 0; i < index.size(); ++i)
+            ordinal += index[i] * m_strides_[i];
+        return ordinal;
+    }
     using size_type   = typename decltype(index)::size_type;
     size_type ordinal = 0;
     size_type stride  = 1;
@@ -305,8 +990,9 @@ auto Contiguous::coordinate_to_ordinal_(index_vector index) const -> size_type {
 
 void Contiguous::update_hash_() const {
     buffer::detail_::hash_utilities::HashVisitor visitor;
-    if(m_buffer_.size()) {
-        wtf::buffer::visit_contiguous_buffer<fp_types>(visitor, m_buffer_);
+    if(size()) {
+        wtf::buffer::visit_contiguous_buffer<fp_types>(visitor,
+                                                       *dense_elements_());
         m_hash_ = visitor.get_hash();
     }
     m_recalculate_hash_ = false;
@@ -327,7 +1013,15 @@ Contiguous make_contiguous(const buffer::BufferBase& buffer,
 
     auto lambda = [=](const auto& span) {
         using value_type = std::decay_t<decltype(span[0])>;
-        std::vector<value_type> data(smooth_shape.size());
+        const auto n     = smooth_shape.size();
+        auto& pool       = detail_::BufferPool::instance();
+        if(auto pbuffer = pool.acquire<value_type>(n)) {
+            using wtf::buffer::contiguous_buffer_cast;
+            auto data = contiguous_buffer_cast<value_type>(*pbuffer);
+            std::fill(data.begin(), data.end(), value_type{});
+            return Contiguous(std::move(*pbuffer), std::move(smooth_shape));
+        }
+        auto data = make_elements(n, value_type{});
         return Contiguous(std::move(data), std::move(smooth_shape));
     };
 
@@ -99,7 +99,54 @@ public:
         return lhs.concatenation(rhs).difference(lhs_dummy());
     }
 
+    /** @brief Order of the free LHS indices when they are used as GEMM rows.
+     *
+     *  Unlike lhs_permutation(), which always forces the result's order, this
+     *  method picks the order which avoids the most copies. If the free LHS
+     *  indices appear as a contiguous block of the result we use the result's
+     *  order (the result can then be used as is), otherwise we use LHS's order
+     *  (the result needs to be transposed anyways).
+     */
+    label_type gemm_row_labels() const {
+        auto result_order = m_result_.intersection(m_lhs_);
+        if(is_contiguous_block_(m_result_, result_order)) return result_order;
+        return lhs_free();
+    }
+
+    /// Same as gemm_row_labels(), but for the free RHS indices (GEMM columns)
+    label_type gemm_col_labels() const {
+        auto result_order = m_result_.intersection(m_rhs_);
+        if(is_contiguous_block_(m_result_, result_order)) return result_order;
+        return rhs_free();
+    }
+
+    /** @brief Order of the dummy indices for the GEMM.
+     *
+     *  The LHS order is used unless the dummy indices of the LHS are not
+     *  contiguous, but those of the RHS are.
+     */
+    label_type gemm_sum_labels() const {
+        auto ldummy = lhs_dummy();
+        if(is_contiguous_block_(m_lhs_, ldummy)) return ldummy;
+        auto rdummy = rhs_dummy();
+        if(is_contiguous_block_(m_rhs_, rdummy)) return rdummy;
+        return ldummy;
+    }
+
 private:
+    /// True if @p block appears, in order and without gaps, in @p labels
+    static bool is_contiguous_block_(const label_type& labels,
+                                     const label_type& block) {
+        if(block.size() == 0) return true;
+        const auto offsets = labels.find(block[0]);
+        if(offsets.size() != 1) return false;
+        const auto offset = offsets[0];
+        if(offset + block.size() > labels.size()) return false;
+        for(std::size_t i = 0; i < block.size(); ++i)
+            if(labels[offset + i] != block[i]) return false;
+        return true;
+    }
+
     /// Ensures no tensor contains a repeated label
     void assert_no_repeated_indices_() const {
         const bool result_good = !m_result_.has_repeated_indices();
@@ -16,12 +16,15 @@
 
 #pragma once
 #include "../../backends/eigen/eigen_tensor_impl.hpp"
+#include "../../backends/gett/gett.hpp"
 #include "unary_operation_visitor.hpp"
+#include <optional>
 #include <span>
 #include <tensorwrapper/dsl/dummy_indices.hpp>
 #include <tensorwrapper/shape/smooth.hpp>
 #include <tensorwrapper/shape/smooth_view.hpp>
 #include <type_traits>
+#include <vector>
 #include <wtf/wtf.hpp>
 
 namespace tensorwrapper::buffer::detail_ {
@@ -77,6 +80,7 @@ public:
 
 protected:
     using base_class::make_this_eigen_tensor_;
+    using base_class::this_buffer_is_reusable_;
 
     template<typename FloatType>
     auto make_lhs_eigen_tensor_(std::span<FloatType> data) {
@@ -135,29 +139,194 @@ public:
     }
 };
 
-/// Visitor that calls hadamard_assignment or contraction_assignment
+/** @brief Visitor that calls hadamard_assignment or contraction_assignment
+ *
+ *  The product, scaled by @p alpha, is added to @p beta times the current
+ *  contents of the buffer. Both factors are handed to the backend, so they
+ *  cost no extra passes over the result. If @p beta is zero (the default) the
+ *  buffer is simply overwritten, otherwise it must already hold the same type
+ *  and number of elements as the result.
+ */
 class MultiplicationVisitor : public BinaryOperationVisitor {
 public:
-    using BinaryOperationVisitor::BinaryOperationVisitor;
     using BinaryOperationVisitor::operator();
 
+    MultiplicationVisitor(buffer_type& this_buffer, label_type this_labels,
+                          shape_type this_shape, label_type lhs_labels,
+                          shape_type lhs_shape, label_type rhs_labels,
+                          shape_type rhs_shape, double alpha = 1.0,
+                          double beta = 0.0) :
+      BinaryOperationVisitor(this_buffer, std::move(this_labels),
+                             std::move(this_shape), std::move(lhs_labels),
+                             std::move(lhs_shape), std::move(rhs_labels),
+                             std::move(rhs_shape)),
+      m_alpha_(alpha),
+      m_beta_(beta) {}
+
     template<typename FloatType>
     void operator()(std::span<FloatType> lhs, std::span<FloatType> rhs) {
         using clean_t = std::decay_t<FloatType>;
-        auto pthis    = this->make_this_eigen_tensor_<clean_t>();
-        auto plhs     = this->make_lhs_eigen_tensor_(lhs);
-        auto prhs     = this->make_rhs_eigen_tensor_(rhs);
+        if(m_beta_ != 0.0 && !this->this_buffer_is_reusable_<clean_t>())
+            throw std::runtime_error(
+              "MultiplicationVisitor: can only accumulate into a buffer of the "
+              "same type and size");
+
+        auto pthis = this->make_this_eigen_tensor_<clean_t>();
+        auto plhs  = this->make_lhs_eigen_tensor_(lhs);
+        auto prhs  = this->make_rhs_eigen_tensor_(rhs);
 
+        // N.b. contraction_assignment also handles batched contractions and
+        // direct products
+        const clean_t alpha(m_alpha_);
+        const clean_t beta(m_beta_);
         if(this_labels().is_hadamard_product(lhs_labels(), rhs_labels()))
             pthis->hadamard_assignment(this_labels(), lhs_labels(),
-                                       rhs_labels(), *plhs, *prhs);
-        else if(this_labels().is_contraction(lhs_labels(), rhs_labels()))
-            pthis->contraction_assignment(this_labels(), lhs_labels(),
-                                          rhs_labels(), *plhs, *prhs);
+                                       rhs_labels(), *plhs, *prhs, alpha,
+                                       beta);
         else
+            pthis->contraction_assignment(this_labels(), lhs_labels(),
+                                          rhs_labels(), *plhs, *prhs, alpha,
+                                          beta);
+    }
+
+private:
+    double m_alpha_;
+    double m_beta_;
+};
+
+/** @brief Where the elements of an operand are within the buffer holding
+ *         them.
+ *
+ *  The first element is @p offset elements into the buffer and consecutive
+ *  elements of the i-th mode are @p strides[i] elements apart.
+ */
+struct StridedLayout {
+    std::size_t offset = 0;
+    std::vector<std::size_t> strides;
+};
+
+/** @brief Visitor that contracts operands in place from their strided
+ *         layouts.
+ *
+ *  The visited spans are the whole buffers holding the operands, e.g., the
+ *  buffer a slice was taken from, and the operands are found in them via
+ *  their StridedLayout. Rather than first copying the operands into dense
+ *  arrays, the product is formed by a single GETT contraction which reads
+ *  them where they are.
+ *
+ *  Only (batched) contractions, i.e., products where every index appears in
+ *  two of the three tensors, or in all three, and at least one index is
+ *  summed over, can be done this way. For any other product is_contraction()
+ *  is false and the visitor must not be used.
+ */
+class StridedContractionVisitor : public BinaryOperationVisitor {
+public:
+    using BinaryOperationVisitor::operator();
+
+    StridedContractionVisitor(buffer_type& this_buffer, label_type this_labels,
+                              shape_type this_shape, label_type lhs_labels,
+                              shape_type lhs_shape, StridedLayout lhs_layout,
+                              label_type rhs_labels, shape_type rhs_shape,
+                              StridedLayout rhs_layout, double alpha = 1.0,
+                              double beta = 0.0) :
+      BinaryOperationVisitor(this_buffer, std::move(this_labels),
+                             std::move(this_shape), std::move(lhs_labels),
+                             std::move(lhs_shape), std::move(rhs_labels),
+                             std::move(rhs_shape)),
+      m_lhs_offset_(lhs_layout.offset),
+      m_rhs_offset_(rhs_layout.offset),
+      m_alpha_(alpha),
+      m_beta_(beta) {
+        m_layout_ = make_layout_(lhs_layout.strides, rhs_layout.strides);
+    }
+
+    /// Can the product be formed by a single GETT contraction?
+    bool is_contraction() const noexcept { return m_layout_.has_value(); }
+
+    template<typename FloatType>
+    void operator()(std::span<FloatType> lhs, std::span<FloatType> rhs) {
+        using clean_t = std::decay_t<FloatType>;
+        if(m_beta_ != 0.0 && !this->this_buffer_is_reusable_<clean_t>())
             throw std::runtime_error(
-              "MultiplicationVisitor: Batched contraction NYI");
+              "StridedContractionVisitor: can only accumulate into a buffer of "
+              "the same type and size");
+
+        auto pthis = this->make_this_eigen_tensor_<clean_t>();
+        backends::gett::contraction(*m_layout_, lhs.data() + m_lhs_offset_,
+                                    rhs.data() + m_rhs_offset_,
+                                    pthis->data().data(), clean_t(m_alpha_),
+                                    clean_t(m_beta_));
+    }
+
+private:
+    using size_vector = std::vector<std::size_t>;
+
+    /// Sorts the modes into a GETT layout, or returns std::nullopt if the
+    /// product is not a contraction
+    std::optional<backends::gett::ContractionLayout> make_layout_(
+      const size_vector& lhs_strides, const size_vector& rhs_strides) const {
+        const auto& this_idx = this_labels();
+        const auto& lhs_idx  = lhs_labels();
+        const auto& rhs_idx  = rhs_labels();
+        if(this_idx.has_repeated_indices() || lhs_idx.has_repeated_indices() ||
+           rhs_idx.has_repeated_indices())
+            return std::nullopt;
+
+        // *this is dense, so its strides follow from its shape
+        size_vector this_strides(this_idx.size());
+        std::size_t stride = 1;
+        for(std::size_t i = this_strides.size(); i-- > 0;) {
+            this_strides[i] = stride;
+            stride *= this_shape().extent(i);
+        }
+
+        auto stride_of = [](const label_type& labels,
+                            const size_vector& strides, const auto& x) {
+            const auto modes = labels.find(x);
+            return modes.empty() ? std::size_t{0} : strides[modes[0]];
+        };
+        auto extent_of = [&](const auto& x) {
+            const auto modes = lhs_idx.find(x);
+            if(modes.empty()) return rhs_shape().extent(rhs_idx.find(x)[0]);
+            return lhs_shape().extent(modes[0]);
+        };
+        auto add_mode = [&](backends::gett::ModeGroup& group, const auto& x) {
+            group.add_mode(extent_of(x), stride_of(lhs_idx, lhs_strides, x),
+                           stride_of(rhs_idx, rhs_strides, x),
+                           stride_of(this_idx, this_strides, x));
+        };
+
+        backends::gett::ContractionLayout layout;
+        for(const auto& x : this_idx) {
+            const bool in_lhs = lhs_idx.count(x) > 0;
+            const bool in_rhs = rhs_idx.count(x) > 0;
+            if(in_lhs && in_rhs)
+                add_mode(layout.batch, x);
+            else if(in_lhs)
+                add_mode(layout.rows, x);
+            else if(in_rhs)
+                add_mode(layout.cols, x);
+            else
+                return std::nullopt;
+        }
+        for(const auto& x : lhs_idx) {
+            if(this_idx.count(x) > 0) continue;
+            if(rhs_idx.count(x) == 0) return std::nullopt; // Needs a trace
+            add_mode(layout.sum, x);
+        }
+        for(const auto& x : rhs_idx) {
+            if(this_idx.count(x) == 0 && lhs_idx.count(x) == 0)
+                return std::nullopt;
+        }
+        if(layout.sum.extents.empty()) return std::nullopt;
+        return layout;
     }
+
+    std::optional<backends::gett::ContractionLayout> m_layout_;
+    std::size_t m_lhs_offset_;
+    std::size_t m_rhs_offset_;
+    double m_alpha_;
+    double m_beta_;
 };
 
 } // namespace tensorwrapper::buffer::detail_
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "buffer_pool.hpp"
+#include <algorithm>
+#include <tensorwrapper/types/floating_point.hpp>
+#include <utility>
+
+namespace tensorwrapper::buffer::detail_ {
+
+// N.b. buffers leaving the pool are always moved into a container declared
+// before the lock, so that freeing them happens after the lock is released
+
+BufferPool& BufferPool::instance() {
+    static BufferPool pool;
+    return pool;
+}
+
+void BufferPool::release(buffer_type&& buffer) noexcept {
+    if(limit() == 0 || buffer.size() == 0) return;
+    try {
+        auto lambda = [](auto&& span) {
+            using value_type = std::decay_t<decltype(span[0])>;
+            return std::make_pair(std::type_index(typeid(value_type)),
+                                  span.size() * sizeof(value_type));
+        };
+        using fp_types = types::floating_point_types;
+        auto [type, nbytes] =
+          wtf::buffer::visit_contiguous_buffer<fp_types>(lambda, buffer);
+        Entry entry{type, buffer.size(), nbytes, std::move(buffer)};
+
+        entry_container freed;
+        std::lock_guard lock(m_mutex_);
+        const auto max_bytes = limit();
+        if(entry.nbytes > max_bytes) return;
+        shrink_to_(max_bytes - entry.nbytes, freed);
+        m_stats_.bytes_retained += entry.nbytes;
+        m_stats_.high_water_mark =
+          std::max(m_stats_.high_water_mark, m_stats_.bytes_retained);
+        m_entries_.push_back(std::move(entry));
+    } catch(...) {
+        // Not pooling a buffer is never an error
+    }
+}
+
+BufferPoolStats BufferPool::stats() const noexcept {
+    std::lock_guard lock(m_mutex_);
+    return m_stats_;
+}
+
+void BufferPool::clear() noexcept {
+    entry_container freed;
+    std::lock_guard lock(m_mutex_);
+    freed.swap(m_entries_);
+    m_stats_ = BufferPoolStats{};
+}
+
+void BufferPool::set_limit(size_type nbytes) noexcept {
+    entry_container freed;
+    std::lock_guard lock(m_mutex_);
+    m_limit_.store(nbytes, std::memory_order_relaxed);
+    shrink_to_(nbytes, freed);
+}
+
+std::optional<BufferPool::buffer_type> BufferPool::acquire_(
+  std::type_index type, size_type n) noexcept {
+    if(limit() == 0) return std::nullopt;
+    std::lock_guard lock(m_mutex_);
+
+    // Newest first, since its memory is the most likely to still be cached
+    auto matches = [&](const Entry& entry) {
+        return entry.type == type && entry.size == n;
+    };
+    auto it = std::find_if(m_entries_.rbegin(), m_entries_.rend(), matches);
+    if(it == m_entries_.rend()) {
+        ++m_stats_.misses;
+        return std::nullopt;
+    }
+    ++m_stats_.hits;
+    m_stats_.bytes_retained -= it->nbytes;
+    std::optional<buffer_type> rv(std::move(it->buffer));
+    m_entries_.erase(std::next(it).base());
+    return rv;
+}
+
+void BufferPool::shrink_to_(size_type nbytes, entry_container& freed) {
+    while(m_stats_.bytes_retained > nbytes) {
+        m_stats_.bytes_retained -= m_entries_.front().nbytes;
+        freed.push_back(std::move(m_entries_.front()));
+        m_entries_.pop_front();
+    }
+}
+
+} // namespace tensorwrapper::buffer::detail_
+
+namespace tensorwrapper::buffer {
+
+BufferPoolStats buffer_pool_stats() noexcept {
+    return detail_::BufferPool::instance().stats();
+}
+
+void clear_buffer_pool() noexcept { detail_::BufferPool::instance().clear(); }
+
+std::size_t buffer_pool_limit() noexcept {
+    return detail_::BufferPool::instance().limit();
+}
+
+void set_buffer_pool_limit(std::size_t nbytes) noexcept {
+    detail_::BufferPool::instance().set_limit(nbytes);
+}
+
+} // namespace tensorwrapper::buffer
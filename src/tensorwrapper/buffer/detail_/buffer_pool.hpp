@@ -0,0 +1,133 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <tensorwrapper/buffer/allocation_policy.hpp>
+#include <tensorwrapper/buffer/buffer_pool_stats.hpp>
+#include <tensorwrapper/concepts/floating_point.hpp>
+#include <typeindex>
+#include <typeinfo>
+#include <wtf/wtf.hpp>
+
+namespace tensorwrapper::buffer::detail_ {
+
+/** @brief Process-wide, thread-safe pool of recycled element buffers.
+ *
+ *  Buffers are pooled by size class, where a size class is an element type
+ *  and a number of elements. The size of a Contiguous buffer must match its
+ *  shape exactly, so a request is only served by a buffer of exactly its
+ *  size class. Recycled buffers hold the elements of their previous owner,
+ *  i.e., requests get buffers with unspecified contents.
+ *
+ *  The pool holds at most limit() bytes. A buffer which would take it over
+ *  the limit makes room by freeing the oldest buffers in the pool; buffers
+ *  bigger than the limit are freed rather than pooled.
+ *
+ *  Recycled memory keeps the pages it was first given, so it can not follow
+ *  an AllocationPolicy. Requests which default_allocation_policy() would
+ *  give huge pages or interleave are therefore never served by the pool.
+ */
+class BufferPool {
+public:
+    /// Type of the buffers in the pool
+    using buffer_type = wtf::buffer::FloatBuffer;
+
+    /// Type used for sizes
+    using size_type = std::size_t;
+
+    /// The process-wide pool
+    static BufferPool& instance();
+
+    /** @brief Takes a buffer of @p n elements of type @p T from the pool.
+     *
+     *  @return The buffer, or std::nullopt if the pool has none or if the
+     *          default allocation policy applies to the request (the caller
+     *          then allocates one itself). The contents of the buffer are
+     *          unspecified.
+     *
+     *  @throw None No throw guarantee.
+     */
+    template<concepts::FloatingPoint T>
+    std::optional<buffer_type> acquire(size_type n) noexcept {
+        const auto policy = default_allocation_policy();
+        const bool hints  = policy.huge_pages || policy.numa_interleave;
+        if(hints && n * sizeof(T) >= policy.min_bytes) return std::nullopt;
+        return acquire_(typeid(T), n);
+    }
+
+    /** @brief Gives @p buffer to the pool.
+     *
+     *  @p buffer is pooled if the pool is enabled and it fits under the limit,
+     *  otherwise it is freed. Either way @p buffer is left in a valid, but
+     *  unspecified state.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void release(buffer_type&& buffer) noexcept;
+
+    /// Statistics about *this
+    BufferPoolStats stats() const noexcept;
+
+    /// Frees all of the pooled buffers and resets the statistics
+    void clear() noexcept;
+
+    /// The most bytes *this will hold
+    size_type limit() const noexcept {
+        return m_limit_.load(std::memory_order_relaxed);
+    }
+
+    /// Sets the most bytes *this will hold, freeing buffers as needed
+    void set_limit(size_type nbytes) noexcept;
+
+private:
+    /// A pooled buffer and its size class
+    struct Entry {
+        std::type_index type;
+        size_type size;
+        size_type nbytes;
+        buffer_type buffer;
+    };
+
+    /// Type of the container holding the entries, oldest first
+    using entry_container = std::deque<Entry>;
+
+    /// Implements acquire once the type is erased
+    std::optional<buffer_type> acquire_(std::type_index type,
+                                        size_type n) noexcept;
+
+    /// Moves the oldest entries to @p freed until at most @p nbytes are held.
+    /// Assumes the lock is held
+    void shrink_to_(size_type nbytes, entry_container& freed);
+
+    /// Guards everything but m_limit_
+    mutable std::mutex m_mutex_;
+
+    /// The pooled buffers
+    entry_container m_entries_;
+
+    /// Hit/miss counters and the number of bytes held
+    BufferPoolStats m_stats_;
+
+    /// The most bytes *this will hold
+    std::atomic<size_type> m_limit_ = 0;
+};
+
+} // namespace tensorwrapper::buffer::detail_
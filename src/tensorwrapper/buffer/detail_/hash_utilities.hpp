@@ -15,8 +15,16 @@
  */
 
 #pragma once
+#include "../../backends/eigen/thread_pool.hpp"
+#include <algorithm>
+#include <bit>
 #include <boost/container_hash/hash.hpp>
+#include <cstdint>
+#include <cstring>
+#include <span>
 #include <tensorwrapper/types/floating_point.hpp>
+#include <type_traits>
+#include <vector>
 
 /** @namespace tensorwrapper::buffer::detail_::hash_utilities
  *  @brief Utilities for hashing EigenTensor instances
@@ -74,6 +82,117 @@ void hash_input(hash_type& seed, const types::interval_type<T>& value) {
 
 #endif
 
+/// Large buffers are hashed in chunks of this many bytes. The size is fixed
+/// so that the hash does not depend on the number of threads.
+inline constexpr std::size_t hash_chunk_bytes = std::size_t{1} << 20;
+
+/** @brief Hashes the bytes [@p data, @p data + @p nbytes).
+ *
+ *  This is the 64-bit xxHash algorithm. Its main loop feeds 32-byte stripes
+ *  to four independent accumulators, so consecutive iterations do not wait
+ *  on each other and the loop runs at close to memory bandwidth.
+ *
+ *  @param[in] data The first byte to hash.
+ *  @param[in] nbytes The number of bytes to hash.
+ *  @param[in] seed Value to start the hash from.
+ *
+ *  @return The hash of the bytes.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline std::uint64_t hash_bytes(const std::byte* data, std::size_t nbytes,
+                                std::uint64_t seed) noexcept {
+    constexpr std::uint64_t p1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t p2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr std::uint64_t p3 = 0x165667B19E3779F9ull;
+    constexpr std::uint64_t p4 = 0x85EBCA77C2B2AE63ull;
+    constexpr std::uint64_t p5 = 0x27D4EB2F165667C5ull;
+
+    auto read64 = [](const std::byte* p) {
+        std::uint64_t rv;
+        std::memcpy(&rv, p, sizeof(rv));
+        return rv;
+    };
+    auto round = [](std::uint64_t acc, std::uint64_t input) {
+        return std::rotl(acc + input * p2, 31) * p1;
+    };
+
+    const auto* p   = data;
+    const auto* end = data + nbytes;
+    std::uint64_t h;
+    if(nbytes >= 32) {
+        std::uint64_t v[4] = {seed + p1 + p2, seed + p2, seed, seed - p1};
+        for(; end - p >= 32; p += 32)
+            for(std::size_t i = 0; i < 4; ++i)
+                v[i] = round(v[i], read64(p + 8 * i));
+        h = std::rotl(v[0], 1) + std::rotl(v[1], 7) + std::rotl(v[2], 12) +
+            std::rotl(v[3], 18);
+        for(auto vi : v) h = (h ^ round(0, vi)) * p1 + p4;
+    } else {
+        h = seed + p5;
+    }
+    h += nbytes;
+
+    for(; end - p >= 8; p += 8)
+        h = std::rotl(h ^ round(0, read64(p)), 27) * p1 + p4;
+    if(end - p >= 4) {
+        std::uint32_t word;
+        std::memcpy(&word, p, sizeof(word));
+        h = std::rotl(h ^ (std::uint64_t{word} * p1), 23) * p2 + p3;
+        p += 4;
+    }
+    for(; p != end; ++p)
+        h = std::rotl(h ^ (std::to_integer<std::uint64_t>(*p) * p5), 11) * p1;
+
+    h ^= h >> 33;
+    h *= p2;
+    h ^= h >> 29;
+    h *= p3;
+    h ^= h >> 32;
+    return h;
+}
+
+/** @brief Hashes the bytes of @p data.
+ *
+ *  Buffers larger than hash_chunk_bytes are split into chunks which are
+ *  hashed in parallel. The hashes of the chunks are then hashed, in order,
+ *  to form the result.
+ *
+ *  @tparam T The type of the elements. Must be trivially copyable.
+ *
+ *  @param[in] data The elements to hash.
+ *  @param[in] seed Value to start the hash from.
+ *
+ *  @return The hash of the elements.
+ */
+template<typename T>
+hash_type hash_elements(std::span<const T> data, hash_type seed) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* bytes  = reinterpret_cast<const std::byte*>(data.data());
+    const auto nbytes  = data.size_bytes();
+    const auto nchunks = (nbytes + hash_chunk_bytes - 1) / hash_chunk_bytes;
+    if(nchunks <= 1) return hash_bytes(bytes, nbytes, seed);
+
+    std::vector<std::uint64_t> chunk_hashes(nchunks);
+    auto fn = [&](std::size_t first, std::size_t last) {
+        for(auto i = first; i < last; ++i) {
+            const auto offset = i * hash_chunk_bytes;
+            const auto n      = std::min(hash_chunk_bytes, nbytes - offset);
+            chunk_hashes[i]   = hash_bytes(bytes + offset, n, seed);
+        }
+    };
+    backends::eigen::parallel_for(nchunks, hash_chunk_bytes, fn);
+    const auto* phashes = chunk_hashes.data();
+    return hash_bytes(reinterpret_cast<const std::byte*>(phashes),
+                      nchunks * sizeof(std::uint64_t), seed);
+}
+
+/** @brief Hashes the elements of a buffer.
+ *
+ *  Plain floating-point elements are hashed by their bytes with
+ *  hash_elements. Other element types (e.g., those tracking uncertainties)
+ *  are hashed element by element with hash_input.
+ */
 class HashVisitor {
 public:
     HashVisitor(hash_type seed = 0) : m_seed_(seed) {}
@@ -82,8 +201,12 @@ public:
 
     template<typename T>
     void operator()(std::span<const T> data) {
-        for(std::size_t i = 0; i < data.size(); ++i) {
-            hash_input(m_seed_, data[i]);
+        if constexpr(std::is_floating_point_v<T>) {
+            m_seed_ = hash_elements(data, m_seed_);
+        } else {
+            for(std::size_t i = 0; i < data.size(); ++i) {
+                hash_input(m_seed_, data[i]);
+            }
         }
     }
 
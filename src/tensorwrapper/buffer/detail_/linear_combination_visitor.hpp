@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "unary_operation_visitor.hpp"
+#include <memory>
+#include <tensorwrapper/buffer/contiguous.hpp>
+#include <vector>
+
+namespace tensorwrapper::buffer::detail_ {
+
+/** @brief Visitor that calls linear_combination_assignment.
+ *
+ *  The visited buffer holds the elements of the first term. The elements of
+ *  the remaining terms are taken from the terms, which must hold the same
+ *  floating-point type as the first term.
+ */
+class LinearCombinationVisitor : public UnaryOperationVisitor {
+public:
+    /// One term of the linear combination
+    struct LinearTerm {
+        /// What the term is multiplied by
+        double coefficient;
+
+        /// The labels of the term
+        label_type labels;
+
+        /// The shape of the term
+        shape_type shape;
+
+        /// The elements of the term, dense and row-major
+        std::shared_ptr<const buffer_type> elements;
+    };
+
+    /// Type of the terms of the linear combination
+    using term_vector = std::vector<LinearTerm>;
+
+    LinearCombinationVisitor(buffer_type& this_buffer, label_type this_labels,
+                             shape_type this_shape, term_vector terms) :
+      UnaryOperationVisitor(this_buffer, std::move(this_labels),
+                            std::move(this_shape), terms.at(0).labels,
+                            terms.at(0).shape),
+      m_terms_(std::move(terms)) {}
+
+    const auto& terms() const { return m_terms_; }
+
+    template<typename FloatType>
+    void operator()(std::span<FloatType> first) {
+        using clean_t     = std::decay_t<FloatType>;
+        using tensor_type = backends::eigen::EigenTensor<clean_t>;
+
+        auto pthis = this->make_this_eigen_tensor_<clean_t>();
+
+        std::vector<std::unique_ptr<tensor_type>> ptensors;
+        ptensors.push_back(this->make_other_eigen_tensor_(first));
+        for(std::size_t i = 1; i < m_terms_.size(); ++i) {
+            /// XXX: Same const_cast as make_other_eigen_tensor_
+            using wtf::buffer::contiguous_buffer_cast;
+            const auto& term = m_terms_[i];
+            typename Contiguous::const_buffer_view view(*term.elements);
+            auto data   = contiguous_buffer_cast<const clean_t>(view);
+            auto* pdata = const_cast<clean_t*>(data.data());
+            std::span<clean_t> non_const_data(pdata, data.size());
+            ptensors.push_back(this->make_eigen_tensor_(non_const_data,
+                                                        term.shape));
+        }
+
+        typename tensor_type::coefficient_vector coefficients;
+        typename tensor_type::label_vector labels;
+        typename tensor_type::const_tensor_vector tensors;
+        for(std::size_t i = 0; i < m_terms_.size(); ++i) {
+            coefficients.push_back(clean_t(m_terms_[i].coefficient));
+            labels.push_back(m_terms_[i].labels);
+            tensors.push_back(ptensors[i].get());
+        }
+
+        pthis->linear_combination_assignment(this->this_labels(), coefficients,
+                                             labels, tensors);
+    }
+
+private:
+    term_vector m_terms_;
+};
+
+} // namespace tensorwrapper::buffer::detail_
@@ -46,6 +46,12 @@ public:
     using const_slice_type = typename traits_type::const_slice_type;
     ///@}
 
+    /// Type of a read-only reference to a buffer
+    using const_buffer_reference = const BufferBase&;
+
+    /// Type of a pointer to a read-only buffer
+    using const_buffer_pointer = std::shared_ptr<const BufferBase>;
+
     /// Type of a pointer to the PIMPL
     using pimpl_pointer = std::unique_ptr<ReplicatedViewPIMPL>;
 
@@ -78,6 +84,8 @@ public:
         set_elem_(slice_index, std::move(value));
     }
 
+    const_buffer_pointer operand() const { return operand_(); }
+
 protected:
     virtual layout_reference layout_() = 0;
 
@@ -98,6 +106,10 @@ protected:
     /// Derived class should implement to be consistent with set_elem
     virtual void set_elem_(const index_vector& slice_index,
                            element_type value) = 0;
+
+    /// Derived class should return a new buffer holding the elements of the
+    /// view
+    virtual const_buffer_pointer operand_() const = 0;
 };
 
 } // namespace tensorwrapper::buffer::detail_
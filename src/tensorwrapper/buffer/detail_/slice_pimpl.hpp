@@ -16,7 +16,9 @@
 
 #pragma once
 #include "replicated_view_pimpl.hpp"
+#include <memory>
 #include <stdexcept>
+#include <tensorwrapper/buffer/contiguous.hpp>
 
 namespace tensorwrapper::buffer::detail_ {
 /** @brief PIMPL holding a non-owning pointer to a Replicated object and slice
@@ -25,6 +27,10 @@ namespace tensorwrapper::buffer::detail_ {
  *  Implements a view of a slice of a Replicated buffer. Slice indices are
  *  relative to the view; index translation to the underlying Replicated is
  *  performed in get_elem and set_elem.
+ *
+ *  For use in the DSL, slices of Contiguous buffers are represented by a
+ *  Contiguous object which aliases the sliced elements where they are (see
+ *  operand_).
  */
 template<typename ReplicatedType>
 class SlicePIMPL : public ReplicatedViewPIMPL<ReplicatedType> {
@@ -34,6 +40,7 @@ private:
 public:
     /// Pull in types from base
     ///@{
+    using typename my_base::const_buffer_pointer;
     using typename my_base::const_element_reference;
     using typename my_base::const_layout_reference;
     using typename my_base::const_slice_type;
@@ -111,6 +118,18 @@ protected:
                                 new_last_elem);
     }
 
+    /// A new alias is made on each call, so it sees the current elements of
+    /// the Replicated object and only shares them while it is used
+    const_buffer_pointer operand_() const override {
+        const auto* pcontiguous =
+          dynamic_cast<const Contiguous*>(&replicated());
+        if(pcontiguous == nullptr)
+            throw std::runtime_error(
+              "Only slices of Contiguous buffers can be used in the DSL.");
+        return std::make_shared<const Contiguous>(
+          pcontiguous->alias_(m_first_elem_, m_last_elem_));
+    }
+
 private:
     ReplicatedType* m_replicated_ptr_;
     index_vector m_first_elem_;
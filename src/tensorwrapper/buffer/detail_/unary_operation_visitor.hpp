@@ -16,11 +16,14 @@
 
 #pragma once
 #include "../../backends/eigen/eigen_tensor_impl.hpp"
+#include "buffer_pool.hpp"
 #include <limits>
 #include <span>
+#include <tensorwrapper/buffer/allocation_policy.hpp>
 #include <tensorwrapper/dsl/dummy_indices.hpp>
 #include <tensorwrapper/shape/smooth.hpp>
 #include <tensorwrapper/shape/smooth_view.hpp>
+#include <tensorwrapper/types/floating_point.hpp>
 #include <type_traits>
 #include <wtf/wtf.hpp>
 
@@ -59,6 +62,11 @@ public:
       m_other_labels_(std::move(other_labels)),
       m_other_shape_(std::move(other_shape)) {}
 
+    /// Gives the elements the result replaced (if any) to the buffer pool
+    ~UnaryOperationVisitor() noexcept {
+        BufferPool::instance().release(std::move(m_old_buffer_));
+    }
+
     const auto& this_shape() const { return m_this_shape_; }
     const auto& other_shape() const { return m_other_shape_; }
 
@@ -71,11 +79,35 @@ protected:
         return backends::eigen::make_eigen_tensor(data, shape);
     }
 
+    /// Can the result be written into the current buffer of *this?
+    template<typename FloatType>
+    bool this_buffer_is_reusable_() const {
+        if(m_pthis_buffer_->size() != m_this_shape_.size()) return false;
+        if(m_pthis_buffer_->size() == 0) return true;
+
+        auto lambda = [](auto&& span) {
+            using value_type = std::decay_t<decltype(span[0])>;
+            return std::is_same_v<value_type, FloatType>;
+        };
+
+        using fp_types = types::floating_point_types;
+        return wtf::buffer::visit_contiguous_buffer<fp_types>(lambda,
+                                                              *m_pthis_buffer_);
+    }
+
     template<typename FloatType>
     auto make_this_eigen_tensor_() {
-        if(m_pthis_buffer_->size() != m_this_shape_.size()) {
-            std::vector<FloatType> temp_buffer(m_this_shape_.size());
-            *m_pthis_buffer_ = buffer_type(std::move(temp_buffer));
+        if(!this_buffer_is_reusable_<FloatType>()) {
+            // The old elements may be an operand, so they are kept until
+            // *this is done. The result overwrites every element, so recycled
+            // memory (with whatever it holds) is as good as new memory. N.b.
+            // the pool declines requests the allocation policy applies to.
+            const auto n  = m_this_shape_.size();
+            m_old_buffer_ = std::move(*m_pthis_buffer_);
+            if(auto pbuffer = BufferPool::instance().acquire<FloatType>(n))
+                *m_pthis_buffer_ = std::move(*pbuffer);
+            else
+                *m_pthis_buffer_ = buffer_type(make_elements(n, FloatType{}));
         }
         auto this_span =
           wtf::buffer::contiguous_buffer_cast<FloatType>(*m_pthis_buffer_);
@@ -101,6 +133,9 @@ private:
 
     label_type m_other_labels_;
     shape_type m_other_shape_;
+
+    /// The elements the result replaced
+    buffer_type m_old_buffer_;
 };
 
 class PermuteVisitor : public UnaryOperationVisitor {
@@ -91,7 +91,30 @@ public:
         return m_rhs_.intersection(m_result_).intersection(m_lhs_);
     }
 
+    /** @brief Result labels with the batch labels removed.
+     *
+     *  A batched operation is the same operation repeated for each value of
+     *  the batch indices. The *_nonbatch methods return the labels of the
+     *  repeated operation (repeated labels, if any, are preserved).
+     */
+    label_type result_nonbatch() const { return remove_batch_(m_result_); }
+
+    /// LHS labels with the batch labels removed
+    label_type lhs_nonbatch() const { return remove_batch_(m_lhs_); }
+
+    /// RHS labels with the batch labels removed
+    label_type rhs_nonbatch() const { return remove_batch_(m_rhs_); }
+
 private:
+    /// Returns @p labels without the labels that appear in all three tensors
+    label_type remove_batch_(const label_type& labels) const {
+        const auto batch = result_batch();
+        typename label_type::split_string_type rv;
+        for(const auto& x : labels)
+            if(!batch.count(x)) rv.push_back(x);
+        return label_type(std::move(rv));
+    }
+
     label_type m_result_;
     label_type m_lhs_;
     label_type m_rhs_;
@@ -68,6 +68,13 @@ auto REPLICATED_VIEW::operator=(ReplicatedView&& rhs) noexcept
 TPARAMS
 REPLICATED_VIEW::~ReplicatedView() noexcept = default;
 
+TPARAMS
+auto REPLICATED_VIEW::operator()(string_type labels) const
+  -> labeled_const_type {
+    assert_pimpl_();
+    return labeled_const_type(m_pimpl_->operand(), std::move(labels));
+}
+
 // -----------------------------------------------------------------------------
 // -- Protected methods
 // -----------------------------------------------------------------------------
@@ -64,8 +64,15 @@ template<concepts::FloatingPoint T>
 Tensor add_noise_impl(const Tensor& matrix, double t, std::mt19937& gen) {
     if(t < 0.0) { throw std::invalid_argument("t must be non-negative"); }
 
-    auto& in_buf = buffer::make_contiguous(matrix.buffer());
-    auto in_data = buffer::get_raw_data<const T>(in_buf);
+    const auto& in_buf = buffer::make_contiguous(matrix.buffer());
+    const auto extents = shape_extents(in_buf.shape());
+
+    // Elements stored in another layout are put in row-major order first
+    const auto in_dense =
+      in_buf.layout().is_row_major() ?
+        in_buf :
+        in_buf.copy_block(std::vector<std::size_t>(extents.size(), 0), extents);
+    auto in_data = buffer::get_raw_data<const T>(in_dense);
     std::vector<T> data(in_data.begin(), in_data.end());
 
     if(t > 0.0) {
@@ -77,8 +84,7 @@ Tensor add_noise_impl(const Tensor& matrix, double t, std::mt19937& gen) {
         }
     }
 
-    return utilities::make_tensor(shape_extents(in_buf.shape()), data.begin(),
-                                  data.end());
+    return utilities::make_tensor(extents, data.begin(), data.end());
 }
 
 } // namespace
@@ -32,6 +32,8 @@ public:
             // it.
             throw std::runtime_error("Can't modify const data");
         } else {
+            // A is the storage of the elements. Strides never overlap, so each
+            // element is raised to the power once (padding is too, harmlessly)
             for(auto& a : A) { a = types::pow(a, m_pow_); }
         }
     }
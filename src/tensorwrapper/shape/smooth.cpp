@@ -72,15 +72,25 @@ dsl_reference Smooth::multiplication_assignment_(label_type this_labels,
 
 dsl_reference Smooth::permute_assignment_(label_type this_labels,
                                           const_labeled_reference rhs) {
-    if(this_labels.size() != rhs.labels().size())
-        throw std::runtime_error("Trace NYI");
+    const auto& labels_rhs = rhs.labels();
+    auto smooth_rhs        = rhs.object().as_smooth();
 
-    auto p          = rhs.labels().permutation(this_labels);
-    auto smooth_rhs = rhs.object().as_smooth();
+    if(this_labels.has_repeated_indices())
+        throw std::runtime_error("Result can not contain repeated indices");
 
-    extents_type temp(p.size());
-    for(typename extents_type::size_type i = 0; i < p.size(); ++i)
-        temp[p[i]] = smooth_rhs.extent(i);
+    // Modes of rhs which share a label are traced over together, so they must
+    // have the same extent
+    for(size_type i = 0; i < labels_rhs.size(); ++i) {
+        const auto first = labels_rhs.find(labels_rhs.at(i))[0];
+        if(smooth_rhs.extent(i) != smooth_rhs.extent(first))
+            throw std::runtime_error("Traced modes must have the same extent");
+    }
+
+    // Base verified this_labels is a subset of the labels of rhs. Labels of
+    // rhs which are not in this_labels are traced over.
+    extents_type temp(this_labels.size());
+    for(size_type i = 0; i < this_labels.size(); ++i)
+        temp[i] = smooth_rhs.extent(labels_rhs.find(this_labels.at(i))[0]);
     m_extents_.swap(temp);
 
     return *this;
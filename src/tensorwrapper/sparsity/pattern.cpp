@@ -40,7 +40,8 @@ dsl_reference Pattern::multiplication_assignment_(label_type this_labels,
 
 dsl_reference Pattern::permute_assignment_(label_type this_labels,
                                            const_labeled_reference rhs) {
-    return *this = rhs.object();
+    // N.b. rank of *this differs from rhs if a trace is requested
+    return *this = Pattern(this_labels.size());
 }
 
 } // namespace tensorwrapper::sparsity
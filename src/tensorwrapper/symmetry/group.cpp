@@ -55,7 +55,8 @@ dsl_reference Group::permute_assignment_(label_type this_labels,
     if(rhs.object().size() != 0)
         throw std::runtime_error("Support for non-trivial symmetry NYI!");
 
-    return *this = rhs.object();
+    // N.b. rank of *this differs from rhs if a trace is requested
+    return *this = Group(this_labels.size());
 }
 
 } // namespace tensorwrapper::symmetry
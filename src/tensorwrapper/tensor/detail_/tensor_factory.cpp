@@ -58,11 +58,9 @@ logical_layout_pointer TensorFactory::default_logical_layout(
 }
 
 physical_layout_pointer TensorFactory::default_physical_layout(
-  const_logical_reference logical) {
-    // For now the default physical layout is a copy of the logical layout
-    using physical_layout_type = input_type::physical_layout_type;
-    return std::make_unique<physical_layout_type>(
-      logical.shape(), logical.symmetry(), logical.sparsity());
+  const_logical_reference logical, const_converter_reference converter) {
+    // A default converter copies the logical layout
+    return converter.convert(logical);
 }
 
 bool TensorFactory::can_make_logical_layout(const input_type& input) noexcept {
@@ -100,6 +98,13 @@ void TensorFactory::assert_valid(const input_type& input) {
         }
     }
 
+    if(input.has_converter()) {
+        if(input.has_buffer() || input.has_physical_layout())
+            throw std::runtime_error(
+              "Provided converter is not used when a physical layout or a "
+              "buffer is provided.");
+    }
+
     if(input.has_buffer() || input.has_physical_layout()) {
         if(can_make_logical_layout(input)) return;
 
@@ -147,13 +152,24 @@ pimpl_pointer TensorFactory::construct(TensorInput input) {
 
     if(!input.has_buffer()) {
         if(!input.has_physical_layout()) {
-            input.m_pphysical = default_physical_layout(*input.m_plogical);
+            const auto& logical = *input.m_plogical;
+            input.m_pphysical =
+              input.has_converter()
+                ? default_physical_layout(logical, *input.m_pconverter)
+                : default_physical_layout(logical);
         }
 
         // TODO: Check if we have initialization criteria
-        auto buffer =
-          buffer::make_contiguous<double>(input.m_pphysical->shape());
-        input.m_pbuffer = std::make_unique<decltype(buffer)>(std::move(buffer));
+        const auto& physical = *input.m_pphysical;
+        if(physical.is_row_major()) {
+            auto buffer = buffer::make_contiguous<double>(physical.shape());
+            input.m_pbuffer =
+              std::make_unique<decltype(buffer)>(std::move(buffer));
+        } else { // Padded and/or not row-major, so honor the strides
+            auto elements = buffer::make_elements(physical.storage_size(), 0.0);
+            input.m_pbuffer = std::make_unique<buffer::Contiguous>(
+              buffer::Contiguous::buffer_type(std::move(elements)), physical);
+        }
     }
 
     // Now we have both a logical layout and a buffer so we're done
@@ -56,17 +56,19 @@ public:
     using tensor4_il_type = typename tensor_type::tensor4_il_type;
 
     // Pull types from input_type that we will need for our API
-    using const_shape_reference    = input_type::const_shape_reference;
-    using shape_pointer            = input_type::shape_pointer;
-    using const_symmetry_reference = input_type::const_symmetry_reference;
-    using symmetry_pointer         = input_type::symmetry_pointer;
-    using const_sparsity_reference = input_type::const_sparsity_reference;
-    using sparsity_pointer         = input_type::sparsity_pointer;
-    using const_logical_reference  = input_type::const_logical_reference;
-    using logical_layout_pointer   = input_type::logical_layout_pointer;
-    using const_physical_reference = input_type::const_physical_reference;
-    using physical_layout_pointer  = input_type::physical_layout_pointer;
-    using runtime_view_type        = input_type::runtime_view_type;
+    using const_shape_reference     = input_type::const_shape_reference;
+    using shape_pointer             = input_type::shape_pointer;
+    using const_symmetry_reference  = input_type::const_symmetry_reference;
+    using symmetry_pointer          = input_type::symmetry_pointer;
+    using const_sparsity_reference  = input_type::const_sparsity_reference;
+    using sparsity_pointer          = input_type::sparsity_pointer;
+    using const_logical_reference   = input_type::const_logical_reference;
+    using logical_layout_pointer    = input_type::logical_layout_pointer;
+    using const_physical_reference  = input_type::const_physical_reference;
+    using physical_layout_pointer   = input_type::physical_layout_pointer;
+    using converter_type            = input_type::converter_type;
+    using const_converter_reference = input_type::const_converter_reference;
+    using runtime_view_type         = input_type::runtime_view_type;
 
     // -------------------------------------------------------------------------
     // -- Methods for determining reasonable defaults
@@ -126,18 +128,24 @@ public:
 
     /** @brief Construct's the tensor's default physical layout.
      *
-     *  At present the default physical layout for a tensor is the same as its
-     *  logical layout. Eventually this should take runtime conditions into
-     *  account.
+     *  The physical layout is made by @p converter. Unless the user provided
+     *  a converter (e.g., to store the modes in another order) the default
+     *  physical layout for a tensor is the same as its logical layout.
+     *  Eventually this should take runtime conditions into account.
      *
      *  @param[in] logical The logical layout of the tensor.
+     *  @param[in] converter The object which lays out the modes. Defaults to
+     *                       a default constructed converter_type.
      *
      *  @return The default physical layout for the tensor.
      *
+     *  @throw std::runtime_error if @p converter can not lay out @p logical.
+     *                            Strong throw guarantee.
      *  @throw std::bad_alloc if there is a problem allocating the return.
      */
     static physical_layout_pointer default_physical_layout(
-      const_logical_reference logical);
+      const_logical_reference logical,
+      const_converter_reference converter = converter_type{});
 
     /** @brief Actually constructs the tensor's PIMPL.
      *
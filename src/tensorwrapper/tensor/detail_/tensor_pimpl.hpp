@@ -83,6 +83,23 @@ public:
     /// Provides read-only access to the buffer
     const auto& buffer() const { return *m_pbuffer_; }
 
+    /** @brief Replaces the logical layout of *this.
+     *
+     *  Layouts can not be assigned to, so operations which compute their
+     *  result into the existing buffer of *this use this method to install the
+     *  layout of the result.
+     *
+     *  @param[in] plogical A pointer to the new logical layout of *this.
+     *
+     *  @throw std::runtime_error if @p plogical is a nullptr. Strong throw
+     *                            guarantee.
+     */
+    void set_logical_layout(logical_layout_pointer plogical) {
+        if(plogical == nullptr)
+            throw std::runtime_error("Logical layout should not be null.");
+        m_plogical_ = std::move(plogical);
+    }
+
     // -------------------------------------------------------------------------
     // -- Utility methods
     // -------------------------------------------------------------------------
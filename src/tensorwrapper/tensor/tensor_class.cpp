@@ -14,9 +14,9 @@
  * limitations under the License.
  */
 
-#include "../layout/converter.hpp"
 #include "detail_/tensor_factory.hpp"
 #include "detail_/tensor_pimpl.hpp"
+#include <algorithm>
 #include <tensorwrapper/buffer/contiguous.hpp>
 #include <tensorwrapper/tensor/tensor_class.hpp>
 
@@ -107,23 +107,44 @@ Tensor::dsl_reference Tensor::binary_common_(FxnType&& fxn,
     auto llayout      = lobject.logical_layout();
     auto rlayout      = robject.logical_layout();
     auto pthis_layout = std::make_unique<logical_layout_type>();
-    // auto pthis_layout = llayout.clone_as<logical_layout_type>();
 
     fxn(*pthis_layout, this_labels, llayout(llabels), rlayout(rlabels));
 
-    layout::Converter c;
-    auto pphys_layout = c.convert(*pthis_layout);
-
     const auto& lbuffer = lobject.buffer();
     const auto& rbuffer = robject.buffer();
 
-    auto buffer       = buffer::make_contiguous(lbuffer, pphys_layout->shape());
-    auto pthis_buffer = std::make_unique<decltype(buffer)>(std::move(buffer));
-
-    fxn(*pthis_buffer, this_labels, lbuffer(llabels), rbuffer(rlabels));
+    auto buffer_fxn = [&](auto& this_buffer) {
+        fxn(this_buffer, this_labels, lbuffer(llabels), rbuffer(rlabels));
+    };
+    return assign_result_(buffer_fxn, std::move(pthis_layout),
+                          {&lbuffer, &rbuffer});
+}
 
-    auto new_pimpl = std::make_unique<pimpl_type>(std::move(pthis_layout),
-                                                  std::move(pthis_buffer));
+template<typename FxnType>
+Tensor::dsl_reference Tensor::assign_result_(FxnType&& fxn,
+                                             logical_layout_pointer playout,
+                                             const input_buffers_type& inputs) {
+    // Reuse the buffer *this already has, unless the operation reads it too
+    // and would need to reallocate it
+    if(has_pimpl_()) {
+        auto* pbuffer = dynamic_cast<buffer::Contiguous*>(&buffer());
+        auto pinput   = std::find(inputs.begin(), inputs.end(), pbuffer);
+
+        const bool is_read = pinput != inputs.end();
+        if(pbuffer != nullptr &&
+           (!is_read || pbuffer->size() == playout->shape().size())) {
+            fxn(*pbuffer);
+            m_pimpl_->set_logical_layout(std::move(playout));
+            return *this;
+        }
+    }
+
+    // N.b. the operation allocates the elements, so no need to initialize them
+    auto pbuffer = std::make_unique<buffer::Contiguous>();
+    fxn(*pbuffer);
+
+    auto new_pimpl = std::make_unique<pimpl_type>(std::move(playout),
+                                                  std::move(pbuffer));
     new_pimpl.swap(m_pimpl_);
 
     return *this;
@@ -160,6 +181,49 @@ Tensor::dsl_reference Tensor::multiplication_assignment_(
     return binary_common_(lambda, this_labels, lhs, rhs);
 }
 
+Tensor::dsl_reference Tensor::scaled_multiplication_assignment_(
+  label_type this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    // Scaling only changes the elements, so the layout is that of the product
+    auto lambda = [alpha](auto&& result, auto&& result_labels,
+                          auto&& labeled_lhs, auto&& labeled_rhs) {
+        using result_type = std::decay_t<decltype(result)>;
+        if constexpr(std::is_same_v<result_type, logical_layout_type>)
+            result.multiplication_assignment(result_labels, labeled_lhs,
+                                             labeled_rhs);
+        else
+            result.multiplication_assignment(result_labels, alpha,
+                                             labeled_lhs, labeled_rhs);
+    };
+    return binary_common_(lambda, this_labels, lhs, rhs);
+}
+
+Tensor::dsl_reference Tensor::multiplication_accumulation_(
+  label_type this_labels, double alpha, const_labeled_reference lhs,
+  const_labeled_reference rhs) {
+    const auto& lobject = lhs.object();
+    const auto& llabels = lhs.labels();
+    const auto& robject = rhs.object();
+    const auto& rlabels = rhs.labels();
+
+    // The product is added to the elements *this already has, so the logical
+    // layout of *this does not change
+    auto llayout = lobject.logical_layout();
+    auto rlayout = robject.logical_layout();
+    logical_layout_type product_layout;
+    product_layout.multiplication_assignment(this_labels, llayout(llabels),
+                                             rlayout(rlabels));
+    if(product_layout.are_different(logical_layout()))
+        throw std::runtime_error(
+          "Logical layout of the product is not that of the tensor");
+
+    const auto& lbuffer = lobject.buffer();
+    const auto& rbuffer = robject.buffer();
+    buffer().multiplication_accumulation(this_labels, alpha, lbuffer(llabels),
+                                         rbuffer(rlabels));
+    return *this;
+}
+
 Tensor::dsl_reference Tensor::scalar_multiplication_(
   label_type this_labels, double scalar, const_labeled_reference rhs) {
     const auto& robject = rhs.object();
@@ -170,15 +234,13 @@ Tensor::dsl_reference Tensor::scalar_multiplication_(
 
     pthis_layout->permute_assignment(this_labels, rlayout(rlabels));
 
-    auto pthis_buffer = robject.buffer().clone();
-    auto rbuffer      = robject.buffer()(rlabels);
-    pthis_buffer->scalar_multiplication(this_labels, scalar, rbuffer);
-
-    auto new_pimpl = std::make_unique<pimpl_type>(std::move(pthis_layout),
-                                                  std::move(pthis_buffer));
-    new_pimpl.swap(m_pimpl_);
+    const auto& rbuffer = robject.buffer();
 
-    return *this;
+    auto buffer_fxn = [&](auto& this_buffer) {
+        this_buffer.scalar_multiplication(this_labels, scalar,
+                                          rbuffer(rlabels));
+    };
+    return assign_result_(buffer_fxn, std::move(pthis_layout), {&rbuffer});
 }
 
 Tensor::dsl_reference Tensor::permute_assignment_(label_type this_labels,
@@ -191,15 +253,39 @@ Tensor::dsl_reference Tensor::permute_assignment_(label_type this_labels,
 
     pthis_layout->permute_assignment(this_labels, rlayout(rlabels));
 
-    auto pthis_buffer = robject.buffer().clone();
-    auto rbuffer      = robject.buffer()(rlabels);
-    pthis_buffer->permute_assignment(this_labels, rbuffer);
+    const auto& rbuffer = robject.buffer();
 
-    auto new_pimpl = std::make_unique<pimpl_type>(std::move(pthis_layout),
-                                                  std::move(pthis_buffer));
-    new_pimpl.swap(m_pimpl_);
+    auto buffer_fxn = [&](auto& this_buffer) {
+        this_buffer.permute_assignment(this_labels, rbuffer(rlabels));
+    };
+    return assign_result_(buffer_fxn, std::move(pthis_layout), {&rbuffer});
+}
 
-    return *this;
+Tensor::dsl_reference Tensor::linear_combination_assignment_(
+  label_type this_labels, const linear_terms_type& terms) {
+    // The base class ensured the terms are all permutations of the result, so
+    // the layout is that of any of them
+    const auto& first   = terms.front().second;
+    const auto& fobject = first.object();
+
+    auto flayout      = fobject.logical_layout();
+    auto pthis_layout = flayout.clone_as<logical_layout_type>();
+    pthis_layout->permute_assignment(this_labels, flayout(first.labels()));
+
+    input_buffers_type inputs;
+    typename buffer::BufferBase::linear_terms_type buffer_terms;
+    for(const auto& [coefficient, term] : terms) {
+        const auto& tbuffer = term.object().buffer();
+        buffer_terms.emplace_back(coefficient, tbuffer(term.labels()));
+
+        // The buffer combines terms which are *this in place, e.g., x += y
+        if(&term.object() != this) inputs.push_back(&tbuffer);
+    }
+
+    auto buffer_fxn = [&](auto& this_buffer) {
+        this_buffer.linear_combination_assignment(this_labels, buffer_terms);
+    };
+    return assign_result_(buffer_fxn, std::move(pthis_layout), inputs);
 }
 
 typename Tensor::polymorphic_base::string_type Tensor::to_string_() const {
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tensorwrapper/buffer/buffer.hpp>
+#include <tensorwrapper/buffer/contiguous.hpp>
+#include <tensorwrapper/layout/layout.hpp>
+#include <tensorwrapper/shape/shape.hpp>
+#include <tensorwrapper/utilities/assemble_blocks.hpp>
+
+namespace tensorwrapper::utilities {
+
+Tensor assemble_blocks(
+  const std::vector<std::size_t>& extents,
+  const std::vector<std::pair<std::vector<std::size_t>, Tensor>>& blocks) {
+    if(blocks.empty()) {
+        Tensor t;
+        return t;
+    }
+
+    // The result has the same floating point type as the blocks
+    shape::Smooth shape(extents.begin(), extents.end());
+    const auto& tensor0 = blocks.front().second;
+    auto buffer         = buffer::make_contiguous(tensor0.buffer(), shape);
+    for(const auto& [first_elem, block] : blocks) {
+        const auto& block_buffer = buffer::make_contiguous(block.buffer());
+        buffer.assign_block(first_elem, block_buffer);
+    }
+
+    layout::Physical playout(shape);
+    layout::Logical llayout(shape);
+    return Tensor(std::move(buffer), std::move(llayout), std::move(playout));
+}
+
+} // namespace tensorwrapper::utilities
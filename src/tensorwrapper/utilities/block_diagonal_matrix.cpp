@@ -14,67 +14,23 @@
  * limitations under the License.
  */
 #include <tensorwrapper/buffer/buffer.hpp>
-#include <tensorwrapper/layout/layout.hpp>
-#include <tensorwrapper/shape/shape.hpp>
+#include <tensorwrapper/utilities/assemble_blocks.hpp>
 #include <tensorwrapper/utilities/block_diagonal_matrix.hpp>
 
 namespace tensorwrapper::utilities {
 
-namespace {
-
-struct Initializer {
-    explicit Initializer(shape::Smooth shape) : m_shape(std::move(shape)) {}
-
-    template<typename FloatType>
-    void operator()(const std::span<FloatType>) {
-        using clean_type = std::decay_t<FloatType>;
-        m_buffer         = buffer::make_contiguous<clean_type>(m_shape);
-    }
-
-    buffer::Contiguous m_buffer;
-    shape::Smooth m_shape;
-};
-
-struct BlockDiagonalMatrixKernel {
-    // Initializes assuming square matrix
-    BlockDiagonalMatrixKernel(buffer::Contiguous& buffer, std::size_t offset,
-                              std::size_t extent) :
-      m_pbuffer(&buffer),
-      m_offset(offset),
-      m_row_extent(extent),
-      m_col_extent(extent) {}
-
-    template<typename FloatType>
-    void operator()(const std::span<FloatType> matrix_i) {
-        for(std::size_t i = 0; i < m_row_extent; ++i) {
-            for(std::size_t j = 0; j < m_col_extent; ++j) {
-                m_pbuffer->set_elem({m_offset + i, m_offset + j},
-                                    matrix_i[i * m_col_extent + j]);
-            }
-        }
-    }
-
-    buffer::Contiguous* m_pbuffer;
-
-    std::size_t m_offset;
-
-    std::size_t m_row_extent;
-    std::size_t m_col_extent;
-};
-
-} // namespace
-
 Tensor block_diagonal_matrix(std::vector<Tensor> matrices) {
     if(matrices.empty()) {
         Tensor t;
         return t; // No idea why the compiler won't let us do 'return {};' here
     }
 
-    // All inputs must be Rank 2, square, and the same floating point type.
-    // If so, sum their extent sizes.
+    // All inputs must be Rank 2 and square. If so, place each one on the
+    // diagonal after the previous ones. The types are checked while assembling
     std::size_t size = 0;
-    std::vector<std::size_t> row_extents(matrices.size());
-    for(const auto& matrix : matrices) {
+    std::vector<std::pair<std::vector<std::size_t>, Tensor>> blocks;
+    blocks.reserve(matrices.size());
+    for(auto& matrix : matrices) {
         if(matrix.rank() != 2)
             throw std::runtime_error("All inputs must be matrices (Rank == 2)");
 
@@ -82,30 +38,13 @@ Tensor block_diagonal_matrix(std::vector<Tensor> matrices) {
         if(mshape.extent(0) != mshape.extent(1))
             throw std::runtime_error("All inputs must be square matrices");
 
-        row_extents.push_back(mshape.extent(0));
-        size += row_extents.back();
+        const std::size_t extent = mshape.extent(0);
+        blocks.emplace_back(std::vector<std::size_t>{size, size},
+                            std::move(matrix));
+        size += extent;
     }
 
-    shape::Smooth shape{size, size};
-    layout::Physical olayout(shape);
-
-    Initializer init_kernel(shape);
-    const auto& buffer0 = buffer::make_contiguous(matrices.front().buffer());
-    buffer::visit_contiguous_buffer(init_kernel, buffer0);
-
-    buffer::Contiguous buffer = std::move(init_kernel.m_buffer);
-
-    std::size_t offset = 0;
-
-    for(const auto& matrix : matrices) {
-        const auto& buffer_i   = buffer::make_contiguous(matrix.buffer());
-        std::size_t row_extent = buffer_i.shape().extent(0);
-        BlockDiagonalMatrixKernel kernel(buffer, offset, row_extent);
-        buffer::visit_contiguous_buffer(kernel, buffer_i);
-        offset += row_extent;
-    }
-    layout::Logical llayout(shape);
-    return Tensor(std::move(buffer), std::move(llayout), std::move(olayout));
+    return assemble_blocks({size, size}, blocks);
 }
 
 } // namespace tensorwrapper::utilities
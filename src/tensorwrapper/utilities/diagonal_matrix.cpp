@@ -20,15 +20,19 @@
 
 namespace tensorwrapper::utilities {
 namespace {
+// N.b. the span holds the elements as they are stored, so the i-th diagonal
+// element is element i * stride of it (e.g., for a slice of a NumPy array)
 struct Kernel {
+    std::size_t n;
+    std::size_t stride;
+
     template<typename FloatType>
     auto operator()(const std::span<FloatType>& diagonal_elements) {
         using clean_type = std::decay_t<FloatType>;
-        const auto n     = diagonal_elements.size();
         shape::Smooth new_shape{n, n};
         std::vector<clean_type> data(n * n, 0);
         for(std::size_t i = 0; i < n; ++i) {
-            data[i * n + i] = diagonal_elements[i];
+            data[i * n + i] = diagonal_elements[i * stride];
         }
         buffer::Contiguous buffer(data, new_shape);
         return Tensor(std::move(new_shape), std::move(buffer));
@@ -40,8 +44,11 @@ Tensor diagonal_matrix(const Tensor& diagonal_elements) {
     if(diagonal_elements.rank() != 1) {
         throw std::runtime_error("Diagonal elements must be a vector");
     }
-    Kernel k;
-    auto& buffer = make_contiguous(diagonal_elements.buffer());
+    auto& buffer        = make_contiguous(diagonal_elements.buffer());
+    const auto& layout  = buffer.layout();
+    const auto n        = buffer.shape().extent(0);
+    const auto is_dense = layout.is_row_major();
+    Kernel k{n, is_dense ? std::size_t{1} : layout.strides()[0]};
     return buffer::visit_contiguous_buffer(k, buffer);
 }
 
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../testing/testing.hpp"
+#include <tensorwrapper/backends/cblas/cblas_gemm.hpp>
+#include <vector>
+
+using namespace tensorwrapper;
+using namespace tensorwrapper::backends::cblas;
+
+using supported_fp_types = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_CASE("cblas::gemm", "", supported_fp_types) {
+    // A is 2 by 3, B is 3 by 2, and A^T (B^T) are stored as 3 by 2 (2 by 3)
+    std::vector<TestType> a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<TestType> at{1.0, 4.0, 2.0, 5.0, 3.0, 6.0};
+    std::vector<TestType> b{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<TestType> bt{1.0, 3.0, 5.0, 2.0, 4.0, 6.0};
+    std::vector<TestType> c(4, TestType{-1.0});
+    std::vector<TestType> corr{22.0, 28.0, 49.0, 64.0};
+    TestType zero{0.0}, one{1.0};
+
+#ifdef ENABLE_CBLAS
+    SECTION("A * B") {
+        gemm(false, false, 2, 2, 3, one, a.data(), 3, b.data(), 2, zero,
+             c.data(), 2);
+        REQUIRE(c == corr);
+    }
+
+    SECTION("A * B^T") {
+        gemm(false, true, 2, 2, 3, one, a.data(), 3, bt.data(), 3, zero,
+             c.data(), 2);
+        REQUIRE(c == corr);
+    }
+
+    SECTION("A^T * B") {
+        gemm(true, false, 2, 2, 3, one, at.data(), 2, b.data(), 2, zero,
+             c.data(), 2);
+        REQUIRE(c == corr);
+    }
+
+    SECTION("A^T * B^T") {
+        gemm(true, true, 2, 2, 3, one, at.data(), 2, bt.data(), 3, zero,
+             c.data(), 2);
+        REQUIRE(c == corr);
+    }
+
+    SECTION("alpha and beta") {
+        std::vector<TestType> c2{1.0, 2.0, 3.0, 4.0};
+        gemm(false, false, 2, 2, 3, TestType{2.0}, a.data(), 3, b.data(), 2,
+             one, c2.data(), 2);
+        REQUIRE(c2 == std::vector<TestType>{45.0, 58.0, 101.0, 132.0});
+    }
+
+    SECTION("No summed index") {
+        gemm(false, false, 2, 2, 0, one, a.data(), 0, b.data(), 2, zero,
+             c.data(), 2);
+        REQUIRE(c == std::vector<TestType>(4, TestType{0.0}));
+    }
+#else
+    REQUIRE_THROWS_AS(gemm(false, false, 2, 2, 3, one, a.data(), 3, b.data(),
+                           2, zero, c.data(), 2),
+                      std::runtime_error);
+#endif
+}
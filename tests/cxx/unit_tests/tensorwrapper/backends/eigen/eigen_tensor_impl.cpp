@@ -22,6 +22,9 @@
 #include "../testing/scalar_multiplication.hpp"
 #include "../testing/subtraction_assignment.hpp"
 #include <tensorwrapper/backends/eigen/eigen_tensor_impl.hpp>
+#include <tensorwrapper/backends/gemm_backend.hpp>
+#include <tensorwrapper/backends/num_threads.hpp>
+#include <tensorwrapper/backends/plan_cache_stats.hpp>
 
 using namespace tensorwrapper;
 using namespace tensorwrapper::backends::eigen;
@@ -354,6 +357,39 @@ TEMPLATE_LIST_TEST_CASE("EigenTensorImpl", "", types::floating_point_types) {
         SECTION("rank 4 tensor") {
             testing::tensor4_hadamard_assignment<tensor4_type>();
         }
+
+        SECTION("accumulate") {
+            using label_type = typename matrix_type::label_type;
+            label_type ij("i,j");
+            label_type ji("j,i");
+            std::vector<TestType> out_data(16, TestType(1.0));
+            matrix_type out({out_data.data(), 16}, matrix_shape);
+
+            SECTION("no permutation") {
+                out.hadamard_assignment(ij, ij, ij, matrix, matrix,
+                                        TestType(1.0), TestType(2.0));
+                for(std::size_t i = 0; i < 16; ++i)
+                    REQUIRE(out_data[i] == TestType(2.0) + data[i] * data[i]);
+            }
+
+            SECTION("scaled") {
+                out.hadamard_assignment(ij, ij, ij, matrix, matrix,
+                                        TestType(3.0), TestType(2.0));
+                for(std::size_t i = 0; i < 16; ++i)
+                    REQUIRE(out_data[i] ==
+                            TestType(2.0) + data[i] * data[i] * TestType(3.0));
+            }
+
+            SECTION("permutation") {
+                out.hadamard_assignment(ij, ji, ij, matrix, matrix,
+                                        TestType(1.0), TestType(2.0));
+                for(std::size_t i = 0; i < 4; ++i)
+                    for(std::size_t j = 0; j < 4; ++j)
+                        REQUIRE(out.get_elem({i, j}) ==
+                                TestType(2.0) +
+                                  data[j * 4 + i] * data[i * 4 + j]);
+            }
+        }
     }
 
     SECTION("permute_assignment") {
@@ -386,8 +422,330 @@ TEMPLATE_LIST_TEST_CASE("EigenTensorImpl", "", types::floating_point_types) {
         }
     }
 
+    SECTION("linear_combination_assignment") {
+        using label_type   = typename matrix_type::label_type;
+        using coefficients = typename matrix_type::coefficient_vector;
+        using labels       = typename matrix_type::label_vector;
+        using tensors      = typename matrix_type::const_tensor_vector;
+        label_type ij("i,j");
+        label_type ji("j,i");
+
+        std::vector<TestType> out_data(16, TestType(0.0));
+        matrix_type out({out_data.data(), 16}, matrix_shape);
+
+        SECTION("one pass") {
+            out.linear_combination_assignment(
+              ij, coefficients{TestType(1.0), TestType(-2.0)}, labels{ij, ji},
+              tensors{&matrix, &matrix});
+            for(std::size_t i = 0; i < 4; ++i)
+                for(std::size_t j = 0; j < 4; ++j)
+                    REQUIRE(out.get_elem({i, j}) ==
+                            data[i * 4 + j] - TestType(2.0) * data[j * 4 + i]);
+        }
+
+        SECTION("more terms than one pass combines") {
+            coefficients c{TestType(1.0), TestType(2.0), TestType(-1.0),
+                           TestType(0.5), TestType(3.0)};
+            out.linear_combination_assignment(
+              ij, c, labels{ij, ji, ij, ji, ij},
+              tensors{&matrix, &matrix, &matrix, &matrix, &matrix});
+            for(std::size_t i = 0; i < 4; ++i)
+                for(std::size_t j = 0; j < 4; ++j)
+                    REQUIRE(out.get_elem({i, j}) ==
+                            TestType(3.0) * data[i * 4 + j] +
+                              TestType(2.5) * data[j * 4 + i]);
+        }
+
+        SECTION("in place") {
+            matrix.linear_combination_assignment(
+              ij, coefficients{TestType(1.0), TestType(1.0)}, labels{ji, ij},
+              tensors{&matrix, &matrix});
+            REQUIRE(matrix.get_elem({0, 1}) == TestType(5.0));
+            REQUIRE(matrix.get_elem({1, 0}) == TestType(5.0));
+            REQUIRE(matrix.get_elem({3, 3}) == TestType(30.0));
+        }
+
+        SECTION("accumulate in place") {
+            std::fill(out_data.begin(), out_data.end(), TestType(1.0));
+            out.linear_combination_assignment(
+              ij, coefficients{TestType(2.0), TestType(1.0)}, labels{ij, ji},
+              tensors{&out, &matrix});
+            for(std::size_t i = 0; i < 4; ++i)
+                for(std::size_t j = 0; j < 4; ++j)
+                    REQUIRE(out.get_elem({i, j}) ==
+                            TestType(2.0) + data[j * 4 + i]);
+        }
+
+        SECTION("scale in place") {
+            matrix.linear_combination_assignment(
+              ij, coefficients{TestType(3.0)}, labels{ij}, tensors{&matrix});
+            for(std::size_t i = 0; i < 16; ++i)
+                REQUIRE(data[i] == TestType(3.0) * static_cast<TestType>(i));
+        }
+
+        SECTION("scalar") {
+            label_type e("");
+            scalar_type out_scalar({out_data.data(), 1}, scalar_shape);
+            out_scalar.linear_combination_assignment(
+              e, coefficients{TestType(2.0)}, labels{e}, tensors{&scalar});
+            REQUIRE(out_scalar.get_elem({}) == TestType(0.0));
+        }
+    }
+
     SECTION("contraction_assignment") {
         testing::contraction_assignment_tests<
           scalar_type, vector_type, matrix_type, tensor3_type, tensor4_type>();
     }
+
+    SECTION("contraction_assignment (Eigen GEMM)") {
+        // N.b. if CBLAS is enabled the previous section used it
+        const auto old_backend = backends::get_gemm_backend();
+        backends::set_gemm_backend(backends::GemmBackend::eigen);
+        testing::contraction_assignment_tests<
+          scalar_type, vector_type, matrix_type, tensor3_type, tensor4_type>();
+        backends::set_gemm_backend(old_backend);
+    }
+
+    SECTION("contraction_assignment (accumulate)") {
+        using label_type = typename matrix_type::label_type;
+        label_type ij("i,j");
+        label_type ik("i,k");
+        label_type kj("k,j");
+
+        std::vector<TestType> out_data(16, TestType(1.0));
+        matrix_type out({out_data.data(), 16}, matrix_shape);
+
+        // out_corr(i, j) = beta * out(i, j) + alpha * sum_k a(i, k) * b(k, j)
+        auto gemm_corr = [](auto&& a, auto&& b, auto&& out, TestType alpha,
+                            TestType beta) {
+            std::vector<TestType> rv(16);
+            for(std::size_t i = 0; i < 4; ++i)
+                for(std::size_t j = 0; j < 4; ++j) {
+                    TestType sum(0.0);
+                    for(std::size_t k = 0; k < 4; ++k)
+                        sum += a[i * 4 + k] * b[k * 4 + j];
+                    rv[i * 4 + j] = beta * out[i * 4 + j] + alpha * sum;
+                }
+            return rv;
+        };
+
+        SECTION("GEMM") {
+            const auto corr =
+              gemm_corr(data, data, out_data, TestType(1.0), TestType(2.0));
+            out.contraction_assignment(ij, ik, kj, matrix, matrix,
+                                       TestType(1.0), TestType(2.0));
+            REQUIRE(out_data == corr);
+        }
+
+        SECTION("GEMM with alpha") {
+            const auto corr =
+              gemm_corr(data, data, out_data, TestType(-2.0), TestType(1.0));
+            out.contraction_assignment(ij, ik, kj, matrix, matrix,
+                                       TestType(-2.0), TestType(1.0));
+            REQUIRE(out_data == corr);
+        }
+
+        SECTION("GEMM (Eigen)") {
+            const auto old_backend = backends::get_gemm_backend();
+            backends::set_gemm_backend(backends::GemmBackend::eigen);
+            const auto corr =
+              gemm_corr(data, data, out_data, TestType(3.0), TestType(2.0));
+            out.contraction_assignment(ij, ik, kj, matrix, matrix,
+                                       TestType(3.0), TestType(2.0));
+            backends::set_gemm_backend(old_backend);
+            REQUIRE(out_data == corr);
+        }
+
+        SECTION("GETT") {
+            // out(i, j) = sum_kl t(k, i, l) * t(j, k, l) is not a GEMM
+            label_type kil("k,i,l");
+            label_type jkl("j,k,l");
+            std::vector<TestType> out2_data(4, TestType(1.0));
+            matrix_type out2({out2_data.data(), 4}, shape_type({2, 2}));
+            out2.contraction_assignment(ij, kil, jkl, tensor3, tensor3,
+                                        TestType(2.0), TestType(1.0));
+            for(std::size_t i = 0; i < 2; ++i)
+                for(std::size_t j = 0; j < 2; ++j) {
+                    TestType corr(1.0);
+                    for(std::size_t k = 0; k < 2; ++k)
+                        for(std::size_t l = 0; l < 4; ++l)
+                            corr += TestType(2.0) * data[k * 8 + i * 4 + l] *
+                                    data[j * 8 + k * 4 + l];
+                    REQUIRE(out2.get_elem({i, j}) == corr);
+                }
+        }
+
+        SECTION("aliased") {
+            const auto corr =
+              gemm_corr(data, data, data, TestType(-1.0), TestType(1.0));
+            matrix.contraction_assignment(ij, ik, kj, matrix, matrix,
+                                          TestType(-1.0), TestType(1.0));
+            REQUIRE(data == corr);
+        }
+    }
+
+    SECTION("Thread count") {
+        using label_type   = typename tensor3_type::label_type;
+        const auto old_n   = backends::get_num_threads();
+        const auto n_elems = std::size_t(32 * 64 * 16);
+
+        // Big enough that Eigen splits the work between the threads
+        std::vector<TestType> in_data(n_elems);
+        for(std::size_t i = 0; i < n_elems; ++i)
+            in_data[i] = static_cast<TestType>(i % 97);
+        tensor3_type in({in_data.data(), n_elems}, shape_type({32, 64, 16}));
+
+        label_type ijk("i,j,k");
+        label_type kji("k,j,i");
+        auto run = [&](std::size_t n_threads) {
+            backends::set_num_threads(n_threads);
+            REQUIRE(backends::get_num_threads() == n_threads);
+
+            std::vector<TestType> rv(3 * n_elems);
+            shape_type out_shape({16, 64, 32});
+            tensor3_type sum({rv.data(), n_elems}, out_shape);
+            tensor3_type perm({rv.data() + n_elems, n_elems}, out_shape);
+            tensor3_type scaled({rv.data() + 2 * n_elems, n_elems}, out_shape);
+            sum.addition_assignment(kji, ijk, ijk, in, in);
+            perm.permute_assignment(kji, ijk, in);
+            scaled.scalar_multiplication(kji, ijk, TestType(2.0), in);
+            return rv;
+        };
+
+        const auto serial   = run(1);
+        const auto parallel = run(4);
+        backends::set_num_threads(old_n);
+
+        REQUIRE(serial == parallel);
+        // Element (k, j, i) = (1, 2, 3) of perm is element (3, 2, 1) of in
+        const auto perm_elem = serial[n_elems + 1 * 64 * 32 + 2 * 32 + 3];
+        REQUIRE(perm_elem == in_data[3 * 64 * 16 + 2 * 16 + 1]);
+    }
+
+    SECTION("contraction_assignment (cached plan)") {
+        using label_type = typename matrix_type::label_type;
+        backends::clear_plan_cache();
+
+        std::vector<TestType> out_data(16, TestType(0.0));
+        std::span<TestType> out_span(out_data.data(), out_data.size());
+        matrix_type out(out_span, shape_type({4, 4}));
+        label_type o("j,i");
+        label_type l("i,k");
+        label_type r("k,j");
+
+        out.contraction_assignment(o, l, r, matrix, matrix);
+        const auto first = out_data;
+        auto stats       = backends::plan_cache_stats();
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 0);
+
+        out.fill(TestType(0.0));
+        out.contraction_assignment(o, l, r, matrix, matrix);
+        REQUIRE(out_data == first);
+        stats = backends::plan_cache_stats();
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.hits == 1);
+        REQUIRE(out.get_elem({1, 0}) == TestType(62.0));
+    }
+
+    SECTION("element-wise operations are not cached") {
+        using label_type = typename matrix_type::label_type;
+        backends::clear_plan_cache();
+
+        std::vector<TestType> out_data(16, TestType(0.0));
+        std::span<TestType> out_span(out_data.data(), out_data.size());
+        matrix_type out(out_span, shape_type({4, 4}));
+        out.addition_assignment(label_type("j,i"), label_type("i,j"),
+                                label_type("i,j"), matrix, matrix);
+        REQUIRE(out.get_elem({1, 0}) == TestType(2.0));
+        REQUIRE(backends::plan_cache_stats().misses == 0);
+    }
+
+    SECTION("traces") {
+        using label_type = typename scalar_type::label_type;
+
+        std::vector<TestType> out_data(16, TestType(0.0));
+        std::span<TestType> out_span(out_data.data(), out_data.size());
+        scalar_type out_scalar(out_span, scalar_shape);
+        vector_type out_vector2(out_span, shape_type({2}));
+        vector_type out_vector4(out_span, shape_type({4}));
+        matrix_type out_matrix(out_span, shape_type({2, 2}));
+        vector_type vector4(data_span, shape_type({4}));
+
+        SECTION("permute_assignment: ii->") {
+            out_scalar.permute_assignment(label_type(""), label_type("i,i"),
+                                          matrix);
+            REQUIRE(out_scalar.get_elem({}) == TestType(30.0));
+        }
+
+        SECTION("permute_assignment: ij->j") {
+            out_vector4.permute_assignment(label_type("j"), label_type("i,j"),
+                                           matrix);
+            REQUIRE(out_vector4.get_elem({0}) == TestType(24.0));
+            REQUIRE(out_vector4.get_elem({1}) == TestType(28.0));
+            REQUIRE(out_vector4.get_elem({2}) == TestType(32.0));
+            REQUIRE(out_vector4.get_elem({3}) == TestType(36.0));
+        }
+
+        SECTION("permute_assignment: ijjk->i") {
+            out_vector2.permute_assignment(label_type("i"),
+                                           label_type("i,j,j,k"), tensor4);
+            REQUIRE(out_vector2.get_elem({0}) == TestType(14.0));
+            REQUIRE(out_vector2.get_elem({1}) == TestType(46.0));
+        }
+
+        SECTION("permute_assignment: ijjk->ki") {
+            out_matrix.permute_assignment(label_type("k,i"),
+                                          label_type("i,j,j,k"), tensor4);
+            REQUIRE(out_matrix.get_elem({0, 0}) == TestType(6.0));
+            REQUIRE(out_matrix.get_elem({0, 1}) == TestType(22.0));
+            REQUIRE(out_matrix.get_elem({1, 0}) == TestType(8.0));
+            REQUIRE(out_matrix.get_elem({1, 1}) == TestType(24.0));
+        }
+
+        SECTION("permute_assignment: in place") {
+            matrix.permute_assignment(label_type("j"), label_type("i,j"),
+                                      matrix);
+            REQUIRE(matrix.get_elem({0, 0}) == TestType(24.0));
+            REQUIRE(matrix.get_elem({0, 1}) == TestType(28.0));
+            REQUIRE(matrix.get_elem({0, 2}) == TestType(32.0));
+            REQUIRE(matrix.get_elem({0, 3}) == TestType(36.0));
+        }
+
+        SECTION("scalar_multiplication: ii->") {
+            out_scalar.scalar_multiplication(label_type(""), label_type("i,i"),
+                                             TestType(2.0), matrix);
+            REQUIRE(out_scalar.get_elem({}) == TestType(60.0));
+        }
+
+        SECTION("contraction_assignment: ik,jj->i") {
+            label_type o("i");
+            label_type l("i,k");
+            label_type r("j,j");
+            out_vector4.contraction_assignment(o, l, r, matrix, matrix);
+            REQUIRE(out_vector4.get_elem({0}) == TestType(180.0));
+            REQUIRE(out_vector4.get_elem({1}) == TestType(660.0));
+            REQUIRE(out_vector4.get_elem({2}) == TestType(1140.0));
+            REQUIRE(out_vector4.get_elem({3}) == TestType(1620.0));
+        }
+
+        SECTION("contraction_assignment: ii,i->") {
+            label_type o("");
+            label_type l("i,i");
+            label_type r("i");
+            out_scalar.contraction_assignment(o, l, r, matrix, vector4);
+            REQUIRE(out_scalar.get_elem({}) == TestType(70.0));
+        }
+
+        SECTION("contraction_assignment: ij,ik->i") {
+            label_type o("i");
+            label_type l("i,j");
+            label_type r("i,k");
+            out_vector4.contraction_assignment(o, l, r, matrix, matrix);
+            REQUIRE(out_vector4.get_elem({0}) == TestType(36.0));
+            REQUIRE(out_vector4.get_elem({1}) == TestType(484.0));
+            REQUIRE(out_vector4.get_elem({2}) == TestType(1444.0));
+            REQUIRE(out_vector4.get_elem({3}) == TestType(2916.0));
+        }
+    }
 }
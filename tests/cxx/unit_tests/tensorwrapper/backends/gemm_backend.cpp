@@ -0,0 +1,47 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/backends/gemm_backend.hpp>
+
+using namespace tensorwrapper::backends;
+
+TEST_CASE("GemmBackend") {
+    const auto old_backend = get_gemm_backend();
+
+#ifdef ENABLE_CBLAS
+    REQUIRE(has_cblas());
+    REQUIRE(old_backend == GemmBackend::cblas);
+
+    set_gemm_backend(GemmBackend::eigen);
+    REQUIRE(get_gemm_backend() == GemmBackend::eigen);
+
+    set_gemm_backend(GemmBackend::cblas);
+    REQUIRE(get_gemm_backend() == GemmBackend::cblas);
+#else
+    REQUIRE_FALSE(has_cblas());
+    REQUIRE(old_backend == GemmBackend::eigen);
+
+    set_gemm_backend(GemmBackend::eigen);
+    REQUIRE(get_gemm_backend() == GemmBackend::eigen);
+
+    REQUIRE_THROWS_AS(set_gemm_backend(GemmBackend::cblas),
+                      std::runtime_error);
+    REQUIRE(get_gemm_backend() == GemmBackend::eigen);
+#endif
+
+    set_gemm_backend(old_backend);
+}
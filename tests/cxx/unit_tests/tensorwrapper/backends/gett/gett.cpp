@@ -0,0 +1,157 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../testing/testing.hpp"
+#include <tensorwrapper/backends/gett/gett.hpp>
+#include <tensorwrapper/backends/num_threads.hpp>
+#include <vector>
+
+using namespace tensorwrapper;
+using namespace tensorwrapper::backends::gett;
+
+TEMPLATE_LIST_TEST_CASE("gett::contraction", "", types::floating_point_types) {
+    using vector_type = std::vector<TestType>;
+
+    SECTION("C(i,k) = A(j,i) * B(k,j)") {
+        // A is 2 by 3, B is 2 by 2, and C is 3 by 2
+        vector_type a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        vector_type b{1.0, 2.0, 3.0, 4.0};
+        vector_type c(6, TestType{-1.0});
+
+        ContractionLayout layout;
+        layout.rows.add_mode(3, 1, 0, 2); // i
+        layout.cols.add_mode(2, 0, 2, 1); // k
+        layout.sum.add_mode(2, 3, 1, 0);  // j
+        contraction(layout, a.data(), b.data(), c.data());
+
+        vector_type corr{9.0, 19.0, 12.0, 26.0, 15.0, 33.0};
+        REQUIRE(c == corr);
+    }
+
+    SECTION("C(b,i) = A(i,b,j) * B(b,j)") {
+        // A is 2 by 2 by 2, B is 2 by 2, and C is 2 by 2
+        vector_type a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+        vector_type b{1.0, 2.0, 3.0, 4.0};
+        vector_type c(4, TestType{-1.0});
+
+        ContractionLayout layout;
+        layout.batch.add_mode(2, 2, 2, 2); // b
+        layout.rows.add_mode(2, 4, 0, 1);  // i
+        layout.sum.add_mode(2, 1, 1, 0);   // j
+        contraction(layout, a.data(), b.data(), c.data());
+
+        vector_type corr{5.0, 17.0, 25.0, 53.0};
+        REQUIRE(c == corr);
+    }
+
+    SECTION("C(i,k) = alpha * A(j,i) * B(k,j) + beta * C(i,k)") {
+        vector_type a{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        vector_type b{1.0, 2.0, 3.0, 4.0};
+        vector_type c(6, TestType{1.0});
+
+        ContractionLayout layout;
+        layout.rows.add_mode(3, 1, 0, 2); // i
+        layout.cols.add_mode(2, 0, 2, 1); // k
+        layout.sum.add_mode(2, 3, 1, 0);  // j
+        contraction(layout, a.data(), b.data(), c.data(), TestType{3.0},
+                    TestType{2.0});
+
+        vector_type corr{29.0, 59.0, 38.0, 80.0, 47.0, 101.0};
+        REQUIRE(c == corr);
+    }
+
+    SECTION("No summed modes") {
+        vector_type a{1.0, 2.0};
+        vector_type b{3.0, 4.0};
+        vector_type c(4, TestType{-1.0});
+
+        ContractionLayout layout;
+        layout.rows.add_mode(2, 1, 0, 1);
+        layout.cols.add_mode(2, 0, 1, 2);
+        contraction(layout, a.data(), b.data(), c.data());
+
+        vector_type corr{3.0, 6.0, 4.0, 8.0};
+        REQUIRE(c == corr);
+    }
+
+    SECTION("Extents larger than the block sizes") {
+        // C(i,k) = A(j,i) * B(j,k) with i and j split over two modes each
+        const std::size_t ni = 150, nj = 300, nk = 530;
+        vector_type a(nj * ni), b(nj * nk), c(ni * nk);
+        for(std::size_t x = 0; x < a.size(); ++x) a[x] = TestType(x % 7);
+        for(std::size_t x = 0; x < b.size(); ++x) b[x] = TestType(x % 5);
+
+        ContractionLayout layout;
+        layout.rows.add_mode(10, 15, 0, 15 * nk);
+        layout.rows.add_mode(15, 1, 0, nk);
+        layout.cols.add_mode(nk, 0, 1, 1);
+        layout.sum.add_mode(3, 100 * ni, 100 * nk, 0);
+        layout.sum.add_mode(100, ni, nk, 0);
+        contraction(layout, a.data(), b.data(), c.data());
+
+        bool all_good = true;
+        for(std::size_t i = 0; i < ni; ++i) {
+            for(std::size_t k = 0; k < nk; ++k) {
+                TestType corr{0.0};
+                for(std::size_t j = 0; j < nj; ++j)
+                    corr += a[j * ni + i] * b[j * nk + k];
+                if(c[i * nk + k] != corr) all_good = false;
+            }
+        }
+        REQUIRE(all_good);
+    }
+
+    SECTION("Thread count") {
+        // C(b,i,k) = A(b,j,i) * B(j,k) with several tiles per batch
+        const auto old_n        = backends::get_num_threads();
+        const std::size_t nb    = 2, ni = 150, nj = 20, nk = 530;
+        const std::size_t a_ibj = nj * ni, c_ibk = ni * nk;
+        vector_type a(nb * nj * ni), b(nj * nk);
+        for(std::size_t x = 0; x < a.size(); ++x) a[x] = TestType(x % 7);
+        for(std::size_t x = 0; x < b.size(); ++x) b[x] = TestType(x % 5);
+
+        ContractionLayout layout;
+        layout.batch.add_mode(nb, a_ibj, 0, c_ibk);
+        layout.rows.add_mode(ni, 1, 0, nk);
+        layout.cols.add_mode(nk, 0, 1, 1);
+        layout.sum.add_mode(nj, ni, nk, 0);
+        auto run = [&](std::size_t n_threads) {
+            backends::set_num_threads(n_threads);
+            vector_type c(nb * c_ibk);
+            contraction(layout, a.data(), b.data(), c.data());
+            return c;
+        };
+
+        const auto serial   = run(1);
+        const auto parallel = run(4);
+        backends::set_num_threads(old_n);
+
+        REQUIRE(serial == parallel);
+        bool all_good = true;
+        for(std::size_t bi = 0; bi < nb; ++bi) {
+            for(std::size_t i = 0; i < ni; ++i) {
+                for(std::size_t k = 0; k < nk; ++k) {
+                    TestType corr{0.0};
+                    for(std::size_t j = 0; j < nj; ++j)
+                        corr += a[bi * a_ibj + j * ni + i] * b[j * nk + k];
+                    if(serial[bi * c_ibk + i * nk + k] != corr)
+                        all_good = false;
+                }
+            }
+        }
+        REQUIRE(all_good);
+    }
+}
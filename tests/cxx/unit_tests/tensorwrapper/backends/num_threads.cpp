@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <cstdlib>
+#include <tensorwrapper/backends/num_threads.hpp>
+
+using namespace tensorwrapper::backends;
+
+TEST_CASE("num_threads") {
+    const auto old_n = get_num_threads();
+    REQUIRE(old_n >= 1);
+
+    // Threading is opt-in
+    if(std::getenv("TENSORWRAPPER_NUM_THREADS") == nullptr)
+        REQUIRE(old_n == 1);
+
+    set_num_threads(3);
+    REQUIRE(get_num_threads() == 3);
+
+    set_num_threads(1);
+    REQUIRE(get_num_threads() == 1);
+
+    REQUIRE_THROWS_AS(set_num_threads(0), std::runtime_error);
+    REQUIRE(get_num_threads() == 1);
+
+    set_num_threads(old_n);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../testing/testing.hpp"
+#include <tensorwrapper/backends/permute/permute.hpp>
+#include <vector>
+
+using namespace tensorwrapper;
+using namespace tensorwrapper::backends::permute;
+
+namespace {
+
+// out(idx) = in(perm applied to idx), the slow way. perm[i] is the mode of
+// in which matches mode i of out
+template<typename FloatType>
+std::vector<FloatType> reference(const std::vector<FloatType>& in,
+                                 const size_vector& in_extents,
+                                 const size_vector& perm) {
+    const auto in_strides = row_major_strides(in_extents);
+    size_vector out_extents(perm.size());
+    for(std::size_t i = 0; i < perm.size(); ++i)
+        out_extents[i] = in_extents[perm[i]];
+
+    std::vector<FloatType> rv(in.size());
+    size_vector index(perm.size(), 0);
+    for(std::size_t o = 0; o < rv.size(); ++o) {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < perm.size(); ++i)
+            offset += index[i] * in_strides[perm[i]];
+        rv[o] = in[offset];
+        for(std::size_t i = perm.size(); i-- > 0;) {
+            if(++index[i] < out_extents[i]) break;
+            index[i] = 0;
+        }
+    }
+    return rv;
+}
+
+// Layout of out = in permuted by perm (see reference)
+Layout<1> permutation_layout(const size_vector& in_extents,
+                             const size_vector& perm) {
+    const auto in_strides = row_major_strides(in_extents);
+    Layout<1> rv;
+    for(auto mode : perm) {
+        rv.extents.push_back(in_extents[mode]);
+        rv.strides[0].push_back(in_strides[mode]);
+    }
+    return rv;
+}
+
+template<typename FloatType>
+std::vector<FloatType> iota(std::size_t n) {
+    std::vector<FloatType> rv(n);
+    for(std::size_t i = 0; i < n; ++i) rv[i] = static_cast<FloatType>(i % 101);
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("permute::transform", "", types::floating_point_types) {
+    using vector_type = std::vector<TestType>;
+    auto copy         = [](const TestType& x) { return x; };
+
+    SECTION("row_major_strides") {
+        REQUIRE(row_major_strides({}) == size_vector{});
+        REQUIRE(row_major_strides({2, 3, 4}) == size_vector{12, 4, 1});
+    }
+
+    SECTION("scalar") {
+        vector_type in{TestType(3.0)};
+        vector_type out{TestType(0.0)};
+        transform(Layout<1>{}, out.data(), {in.data()}, copy);
+        REQUIRE(out[0] == TestType(3.0));
+    }
+
+    SECTION("empty") {
+        vector_type out{TestType(1.0)};
+        transform(Layout<1>{{0, 3}, {size_vector{3, 1}}}, out.data(),
+                  {out.data()}, copy);
+        REQUIRE(out[0] == TestType(1.0));
+    }
+
+    // The extents are not multiples of the block size, so partial tiles are
+    // tested too
+    using test_type = std::pair<size_vector, size_vector>;
+    std::vector<test_type> tests{
+      {{37, 70}, {0, 1}},             // No permutation
+      {{37, 70}, {1, 0}},             // 2D transpose
+      {{130, 70}, {1, 0}},            // 2D transpose, several tiles
+      {{5, 33, 40, 3}, {0, 2, 1, 3}}, // Inner mode is unchanged
+      {{5, 33, 40, 3}, {1, 0, 3, 2}}, // Pairs of modes swapped
+      {{6, 7, 35}, {2, 0, 1}},        // Cyclic
+      {{1, 40, 1, 33}, {3, 2, 1, 0}}, // Modes of extent 1
+    };
+
+    for(const auto& [extents, perm] : tests) {
+        std::size_t n = 1;
+        for(auto x : extents) n *= x;
+        const auto in     = iota<TestType>(n);
+        const auto corr   = reference(in, extents, perm);
+        const auto layout = permutation_layout(extents, perm);
+
+        vector_type out(n);
+        transform(layout, out.data(), {in.data()}, copy);
+        REQUIRE(out == corr);
+
+        // Work split into arbitrary chunks gives the same result
+        std::size_t n_calls = 0;
+        auto chunked = [&n_calls](std::size_t n_units, std::size_t, auto&& fn) {
+            for(std::size_t i = 0; i < n_units; i += 3, ++n_calls)
+                fn(i, std::min(i + 3, n_units));
+        };
+        vector_type out2(n);
+        transform(layout, out2.data(), {in.data()}, copy, chunked);
+        REQUIRE(out2 == corr);
+        REQUIRE(n_calls > 0);
+    }
+
+    SECTION("fused binary op: C(i,j) = A(i,j) + B(j,i)") {
+        const size_vector extents{45, 38};
+        const auto a = iota<TestType>(45 * 38);
+        auto b       = iota<TestType>(45 * 38);
+        for(auto& x : b) x *= TestType(2.0);
+
+        const auto bt = reference(b, {38, 45}, {1, 0});
+        Layout<2> layout{extents, {size_vector{38, 1}, size_vector{1, 45}}};
+        auto add = [](const TestType& x, const TestType& y) { return x + y; };
+
+        vector_type c(45 * 38);
+        transform(layout, c.data(), {a.data(), b.data()}, add);
+        for(std::size_t i = 0; i < c.size(); ++i)
+            REQUIRE(c[i] == a[i] + bt[i]);
+    }
+}
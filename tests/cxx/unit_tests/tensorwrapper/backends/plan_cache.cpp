@@ -0,0 +1,146 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/backends/plan_cache.hpp>
+
+using namespace tensorwrapper::backends;
+
+namespace {
+
+struct PlanA {
+    std::size_t value;
+};
+
+struct PlanB {
+    std::size_t value;
+};
+
+} // namespace
+
+TEST_CASE("PlanCache") {
+    using label_type = typename PlanKey::label_type;
+
+    auto& cache = PlanCache::instance();
+    cache.clear();
+
+    PlanKey key{typeid(double),
+                {label_type("i,j"), label_type("i,k"), label_type("k,j")},
+                {{2, 3}, {3, 2}}};
+
+    std::size_t ncalls = 0;
+
+    auto make_a = [&ncalls](const PlanKey& k) {
+        ++ncalls;
+        return PlanA{k.labels.size()};
+    };
+
+    SECTION("Empty") {
+        auto stats = plan_cache_stats();
+        REQUIRE(stats.hits == 0);
+        REQUIRE(stats.misses == 0);
+        REQUIRE(stats.size == 0);
+    }
+
+    SECTION("Miss then hit") {
+        auto p0 = cache.get_or_make<PlanA>(key, make_a);
+        REQUIRE(p0->value == 3);
+        REQUIRE(ncalls == 1);
+
+        auto p1 = cache.get_or_make<PlanA>(key, make_a);
+        REQUIRE(p1 == p0);
+        REQUIRE(ncalls == 1);
+
+        auto stats = plan_cache_stats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.size == 1);
+    }
+
+    SECTION("Different keys") {
+        auto p0 = cache.get_or_make<PlanA>(key, make_a);
+
+        auto diff_labels      = key;
+        diff_labels.labels[0] = label_type("j,i");
+
+        auto p1 = cache.get_or_make<PlanA>(diff_labels, make_a);
+
+        auto diff_extents       = key;
+        diff_extents.extents[0] = {2, 4};
+
+        auto p2 = cache.get_or_make<PlanA>(diff_extents, make_a);
+
+        auto diff_type         = key;
+        diff_type.element_type = typeid(float);
+
+        auto p3 = cache.get_or_make<PlanA>(diff_type, make_a);
+
+        REQUIRE(ncalls == 4);
+        REQUIRE(p0 != p1);
+        REQUIRE(p0 != p2);
+        REQUIRE(p0 != p3);
+        REQUIRE(plan_cache_stats().size == 4);
+    }
+
+    SECTION("Different plan types") {
+        auto make_b = [](const PlanKey&) { return PlanB{42}; };
+        auto pa     = cache.get_or_make<PlanA>(key, make_a);
+        auto pb     = cache.get_or_make<PlanB>(key, make_b);
+        REQUIRE(pa->value == 3);
+        REQUIRE(pb->value == 42);
+        REQUIRE(plan_cache_stats().size == 2);
+    }
+
+    SECTION("Bounded size") {
+        auto key_i = [&key](std::size_t i) {
+            auto new_key       = key;
+            new_key.extents[0] = {i};
+            return new_key;
+        };
+        const auto max_size = PlanCache::max_size();
+        for(std::size_t i = 0; i < max_size; ++i)
+            cache.get_or_make<PlanA>(key_i(i), make_a);
+        REQUIRE(plan_cache_stats().size == max_size);
+
+        // Using plan 0 again makes plan 1 the least recently used one, which
+        // is the one evicted when the next plan is added
+        cache.get_or_make<PlanA>(key_i(0), make_a);
+        cache.get_or_make<PlanA>(key_i(max_size), make_a);
+        REQUIRE(plan_cache_stats().size == max_size);
+
+        const auto old_ncalls = ncalls;
+        cache.get_or_make<PlanA>(key_i(0), make_a);
+        REQUIRE(ncalls == old_ncalls);
+        cache.get_or_make<PlanA>(key_i(1), make_a);
+        REQUIRE(ncalls == old_ncalls + 1);
+    }
+
+    SECTION("clear_plan_cache") {
+        auto p0 = cache.get_or_make<PlanA>(key, make_a);
+        clear_plan_cache();
+        auto stats = plan_cache_stats();
+        REQUIRE(stats.hits == 0);
+        REQUIRE(stats.misses == 0);
+        REQUIRE(stats.size == 0);
+
+        // Plans handed out before clearing are still valid
+        REQUIRE(p0->value == 3);
+        cache.get_or_make<PlanA>(key, make_a);
+        REQUIRE(ncalls == 2);
+    }
+
+    cache.clear();
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/backends/scratch_arena.hpp>
+#include <cstdint>
+#include <thread>
+
+using namespace tensorwrapper::backends;
+
+namespace {
+
+// Sets the limit of the arenas for the lifetime of the guard
+struct LimitGuard {
+    explicit LimitGuard(std::size_t nbytes) :
+      m_old_(scratch_memory_limit()) {
+        set_scratch_memory_limit(nbytes);
+    }
+    ~LimitGuard() { set_scratch_memory_limit(m_old_); }
+    std::size_t m_old_;
+};
+
+} // namespace
+
+TEST_CASE("ScratchArena") {
+    // Most sections check that memory is kept between operations
+    LimitGuard guard(std::size_t{1} << 30);
+    ScratchArena arena;
+    using except_t = std::runtime_error;
+
+    auto is_aligned = [](const void* p) {
+        auto address = reinterpret_cast<std::uintptr_t>(p);
+        return address % ScratchArena::alignment == 0;
+    };
+
+    SECTION("Default state") {
+        REQUIRE(arena.capacity() == 0);
+        REQUIRE(arena.size() == 0);
+    }
+
+    SECTION("instance") {
+        auto* pthis = &ScratchArena::instance();
+        REQUIRE(&ScratchArena::instance() == pthis);
+
+        // Each thread has its own arena
+        ScratchArena* pother = nullptr;
+        std::thread t([&pother]() { pother = &ScratchArena::instance(); });
+        t.join();
+        REQUIRE(pother != pthis);
+    }
+
+    SECTION("allocate") {
+        REQUIRE_THROWS_AS(arena.allocate<double>(1), except_t);
+
+        ScratchArena::Scope scope(arena);
+        auto x = arena.allocate<double>(3);
+        auto y = arena.allocate<float>(5);
+        REQUIRE(x.size() == 3);
+        REQUIRE(y.size() == 5);
+        REQUIRE(is_aligned(x.data()));
+        REQUIRE(is_aligned(y.data()));
+
+        // The allocations do not overlap
+        auto* px_end = reinterpret_cast<std::byte*>(x.data() + x.size());
+        REQUIRE(px_end <= reinterpret_cast<std::byte*>(y.data()));
+        REQUIRE(arena.size() == 2 * ScratchArena::alignment);
+        REQUIRE(arena.capacity() >= arena.size());
+
+        // The memory is usable
+        for(std::size_t i = 0; i < x.size(); ++i) x[i] = i;
+        REQUIRE(x[2] == 2.0);
+    }
+
+    SECTION("Scopes release their allocations") {
+        ScratchArena::Scope outer(arena);
+        auto x = arena.allocate<double>(1);
+        {
+            ScratchArena::Scope inner(arena);
+            auto y = arena.allocate<double>(1);
+            REQUIRE(y.data() != x.data());
+            REQUIRE(arena.size() == 2 * ScratchArena::alignment);
+        }
+        REQUIRE(arena.size() == ScratchArena::alignment);
+
+        // The memory of the inner scope is handed out again
+        const auto stride = ScratchArena::alignment / sizeof(double);
+        auto z            = arena.allocate<double>(1);
+        REQUIRE(z.data() == x.data() + stride);
+    }
+
+    SECTION("Memory is kept between operations") {
+        double* px = nullptr;
+        {
+            ScratchArena::Scope scope(arena);
+            px = arena.allocate<double>(10).data();
+        }
+        REQUIRE(arena.size() == 0);
+        const auto capacity = arena.capacity();
+        REQUIRE(capacity > 0);
+
+        ScratchArena::Scope scope(arena);
+        REQUIRE(arena.allocate<double>(10).data() == px);
+        REQUIRE(arena.capacity() == capacity);
+    }
+
+    SECTION("Blocks are merged when the outermost scope ends") {
+        const std::size_t n = 1 << 20;
+        {
+            ScratchArena::Scope scope(arena);
+            arena.allocate<double>(n);
+            arena.allocate<double>(n);
+            arena.allocate<double>(n);
+        }
+        const auto capacity = arena.capacity();
+        REQUIRE(capacity >= 3 * n * sizeof(double));
+
+        // All three now fit in the merged block, so nothing is allocated
+        ScratchArena::Scope scope(arena);
+        auto x = arena.allocate<double>(n);
+        auto y = arena.allocate<double>(n);
+        auto z = arena.allocate<double>(n);
+        REQUIRE(y.data() == x.data() + n);
+        REQUIRE(z.data() == y.data() + n);
+        REQUIRE(arena.capacity() == capacity);
+    }
+
+    SECTION("Memory over the limit is freed") {
+        set_scratch_memory_limit(1 << 20);
+        REQUIRE(scratch_memory_limit() == (1 << 20));
+        REQUIRE(ScratchArena::limit() == (1 << 20));
+        {
+            ScratchArena::Scope scope(arena);
+            arena.allocate<double>(10);
+        }
+        REQUIRE(arena.capacity() > 0);
+        {
+            ScratchArena::Scope scope(arena);
+            arena.allocate<double>(1 << 20);
+            REQUIRE(arena.capacity() > (1 << 20));
+        }
+        REQUIRE(arena.capacity() == 0);
+
+        // With no limit, nothing is kept
+        set_scratch_memory_limit(0);
+        {
+            ScratchArena::Scope scope(arena);
+            arena.allocate<double>(10);
+        }
+        REQUIRE(arena.capacity() == 0);
+    }
+
+    SECTION("release_scratch_memory") {
+        auto& thread_arena = ScratchArena::instance();
+        {
+            ScratchArena::Scope scope(thread_arena);
+            thread_arena.allocate<double>(10);
+        }
+        REQUIRE(thread_arena.capacity() > 0);
+        release_scratch_memory();
+        REQUIRE(thread_arena.capacity() == 0);
+    }
+
+    SECTION("release") {
+        {
+            ScratchArena::Scope scope(arena);
+            arena.allocate<double>(10);
+            REQUIRE_THROWS_AS(arena.release(), except_t);
+        }
+        arena.release();
+        REQUIRE(arena.capacity() == 0);
+        REQUIRE(arena.size() == 0);
+    }
+}
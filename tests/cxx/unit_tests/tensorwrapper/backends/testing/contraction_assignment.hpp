@@ -213,5 +213,132 @@ void contraction_assignment_tests() {
         REQUIRE(tensor3.get_elem({1, 1, 0}) == tensor3_value_type(37.0));
         REQUIRE(tensor3.get_elem({1, 1, 1}) == tensor3_value_type(44.0));
     }
+
+    // The remaining sections write to a tensor which does not alias the
+    // inputs and whose modes need no permuting, just (un)transposing
+    std::vector<matrix_value_type> rhs_data(4, matrix_value_type(0.0));
+    std::vector<matrix_value_type> out_data(4, matrix_value_type(0.0));
+    for(std::size_t i = 0; i < rhs_data.size(); ++i)
+        rhs_data[i] = matrix_value_type(i + 5.0);
+
+    std::span<matrix_value_type> rhs_data_span(rhs_data.data(),
+                                               rhs_data.size());
+    std::span<matrix_value_type> out_data_span(out_data.data(),
+                                               out_data.size());
+    MatrixType rhs_matrix(rhs_data_span, matrix_shape);
+    MatrixType out_matrix(out_data_span, matrix_shape);
+
+    std::vector<tensor3_value_type> out3_data(8, tensor3_value_type(0.0));
+    std::span<tensor3_value_type> out3_data_span(out3_data.data(),
+                                                 out3_data.size());
+    Tensor3Type out_tensor3(out3_data_span, tensor3_shape);
+
+    SECTION("ij,jk->ik (no aliasing)") {
+        label_type o("i,k");
+        label_type l("i,j");
+        label_type r("j,k");
+        out_matrix.contraction_assignment(o, l, r, matrix, rhs_matrix);
+
+        REQUIRE(out_matrix.get_elem({0, 0}) == matrix_value_type(19.0));
+        REQUIRE(out_matrix.get_elem({0, 1}) == matrix_value_type(22.0));
+        REQUIRE(out_matrix.get_elem({1, 0}) == matrix_value_type(43.0));
+        REQUIRE(out_matrix.get_elem({1, 1}) == matrix_value_type(50.0));
+    }
+
+    SECTION("ji,jk->ik") {
+        label_type o("i,k");
+        label_type l("j,i");
+        label_type r("j,k");
+        out_matrix.contraction_assignment(o, l, r, matrix, rhs_matrix);
+
+        REQUIRE(out_matrix.get_elem({0, 0}) == matrix_value_type(26.0));
+        REQUIRE(out_matrix.get_elem({0, 1}) == matrix_value_type(30.0));
+        REQUIRE(out_matrix.get_elem({1, 0}) == matrix_value_type(38.0));
+        REQUIRE(out_matrix.get_elem({1, 1}) == matrix_value_type(44.0));
+    }
+
+    SECTION("ij,kj->ki") {
+        label_type o("k,i");
+        label_type l("i,j");
+        label_type r("k,j");
+        out_matrix.contraction_assignment(o, l, r, matrix, rhs_matrix);
+
+        REQUIRE(out_matrix.get_elem({0, 0}) == matrix_value_type(17.0));
+        REQUIRE(out_matrix.get_elem({0, 1}) == matrix_value_type(39.0));
+        REQUIRE(out_matrix.get_elem({1, 0}) == matrix_value_type(23.0));
+        REQUIRE(out_matrix.get_elem({1, 1}) == matrix_value_type(53.0));
+    }
+
+    SECTION("ij,jk->ki") {
+        label_type o("k,i");
+        label_type l("i,j");
+        label_type r("j,k");
+        out_matrix.contraction_assignment(o, l, r, matrix, rhs_matrix);
+
+        REQUIRE(out_matrix.get_elem({0, 0}) == matrix_value_type(19.0));
+        REQUIRE(out_matrix.get_elem({0, 1}) == matrix_value_type(43.0));
+        REQUIRE(out_matrix.get_elem({1, 0}) == matrix_value_type(22.0));
+        REQUIRE(out_matrix.get_elem({1, 1}) == matrix_value_type(50.0));
+    }
+
+    SECTION("i,j->ij") {
+        label_type o("i,j");
+        label_type l("i");
+        label_type r("j");
+        out_matrix.contraction_assignment(o, l, r, vector, vector);
+
+        REQUIRE(out_matrix.get_elem({0, 0}) == matrix_value_type(1.0));
+        REQUIRE(out_matrix.get_elem({0, 1}) == matrix_value_type(2.0));
+        REQUIRE(out_matrix.get_elem({1, 0}) == matrix_value_type(2.0));
+        REQUIRE(out_matrix.get_elem({1, 1}) == matrix_value_type(4.0));
+    }
+
+    SECTION("bij,bjk->bik") {
+        label_type o("b,i,k");
+        label_type l("b,i,j");
+        label_type r("b,j,k");
+        out_tensor3.contraction_assignment(o, l, r, tensor3, tensor3);
+
+        REQUIRE(out_tensor3.get_elem({0, 0, 0}) == tensor3_value_type(7.0));
+        REQUIRE(out_tensor3.get_elem({0, 0, 1}) == tensor3_value_type(10.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 0}) == tensor3_value_type(15.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 1}) == tensor3_value_type(22.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 0}) == tensor3_value_type(67.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 1}) == tensor3_value_type(78.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 0}) == tensor3_value_type(91.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 1}) == tensor3_value_type(106.0));
+    }
+
+    SECTION("bij,bjk->ikb") {
+        label_type o("i,k,b");
+        label_type l("b,i,j");
+        label_type r("b,j,k");
+        out_tensor3.contraction_assignment(o, l, r, tensor3, tensor3);
+
+        REQUIRE(out_tensor3.get_elem({0, 0, 0}) == tensor3_value_type(7.0));
+        REQUIRE(out_tensor3.get_elem({0, 0, 1}) == tensor3_value_type(67.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 0}) == tensor3_value_type(10.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 1}) == tensor3_value_type(78.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 0}) == tensor3_value_type(15.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 1}) == tensor3_value_type(91.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 0}) == tensor3_value_type(22.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 1}) == tensor3_value_type(106.0));
+    }
+
+    SECTION("ibj,bjk->bki") {
+        label_type o("b,k,i");
+        label_type l("i,b,j");
+        label_type r("b,j,k");
+        out_tensor3.contraction_assignment(o, l, r, tensor3, tensor3);
+
+        REQUIRE(out_tensor3.get_elem({0, 0, 0}) == tensor3_value_type(7.0));
+        REQUIRE(out_tensor3.get_elem({0, 0, 1}) == tensor3_value_type(23.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 0}) == tensor3_value_type(10.0));
+        REQUIRE(out_tensor3.get_elem({0, 1, 1}) == tensor3_value_type(34.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 0}) == tensor3_value_type(43.0));
+        REQUIRE(out_tensor3.get_elem({1, 0, 1}) == tensor3_value_type(91.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 0}) == tensor3_value_type(50.0));
+        REQUIRE(out_tensor3.get_elem({1, 1, 1}) == tensor3_value_type(106.0));
+    }
 }
 } // namespace tensorwrapper::testing
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/buffer/allocation_policy.hpp>
+
+using namespace tensorwrapper;
+using buffer::AllocationPolicy;
+
+TEST_CASE("AllocationPolicy") {
+    AllocationPolicy defaulted;
+    AllocationPolicy all{true, true, 0};
+
+    SECTION("Default state") {
+        REQUIRE_FALSE(defaulted.huge_pages);
+        REQUIRE_FALSE(defaulted.numa_interleave);
+        REQUIRE(defaulted.min_bytes == std::size_t{1} << 21);
+    }
+
+    SECTION("operator==") {
+        REQUIRE(defaulted == AllocationPolicy{});
+        REQUIRE_FALSE(defaulted == all);
+    }
+
+    SECTION("default_allocation_policy") {
+        const auto old = buffer::default_allocation_policy();
+        REQUIRE(old == defaulted);
+
+        buffer::set_default_allocation_policy(all);
+        REQUIRE(buffer::default_allocation_policy() == all);
+
+        buffer::set_default_allocation_policy(old);
+        REQUIRE(buffer::default_allocation_policy() == old);
+    }
+
+    SECTION("make_elements") {
+        // Large enough to span several pages, so the hints are applied
+        const std::size_t n = std::size_t{1} << 20;
+
+        SECTION("Default policy") {
+            auto x = buffer::make_elements(n, 1.0);
+            REQUIRE(x.size() == n);
+            REQUIRE(x.front() == 1.0);
+            REQUIRE(x.back() == 1.0);
+        }
+
+        SECTION("All hints") {
+            auto x = buffer::make_elements(n, 2.0f, all);
+            REQUIRE(x.size() == n);
+            REQUIRE(x.front() == 2.0f);
+            REQUIRE(x.back() == 2.0f);
+        }
+
+        SECTION("No elements") {
+            auto x = buffer::make_elements(0, 3.0, all);
+            REQUIRE(x.empty());
+        }
+    }
+}
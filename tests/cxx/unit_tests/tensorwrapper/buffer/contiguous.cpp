@@ -169,6 +169,80 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
             REQUIRE(matrix_move == matrix);
             REQUIRE(pmatrix_move == &matrix_move);
         }
+
+        SECTION("Copy-on-write") {
+            using buffer::get_raw_data;
+            label_type ij("i,j");
+            label_type ik("i,k");
+            label_type kj("k,j");
+
+            const auto& cmatrix = matrix;
+            const auto* pdata   = get_raw_data<TestType>(cmatrix).data();
+
+            // Copying does not copy the elements
+            Contiguous copy(matrix);
+            const auto& ccopy = copy;
+            REQUIRE(get_raw_data<TestType>(ccopy).data() == pdata);
+
+            SECTION("set_elem") {
+                copy.set_elem({0, 0}, four);
+                REQUIRE(get_raw_data<TestType>(ccopy).data() != pdata);
+                REQUIRE(copy.get_elem({0, 0}) == four);
+                REQUIRE(matrix.get_elem({0, 0}) == one);
+            }
+
+            SECTION("get_mutable_data") {
+                auto copy_data = get_raw_data<TestType>(copy);
+                REQUIRE(copy_data.data() != pdata);
+                copy_data[0] = four;
+                REQUIRE(copy.get_elem({0, 0}) == four);
+                REQUIRE(matrix.get_elem({0, 0}) == one);
+
+                // matrix is the only owner now, so nothing is copied
+                REQUIRE(get_raw_data<TestType>(matrix).data() == pdata);
+            }
+
+            SECTION("Modifying the original") {
+                matrix.set_elem({0, 0}, four);
+                REQUIRE(matrix.get_elem({0, 0}) == four);
+                REQUIRE(copy.get_elem({0, 0}) == one);
+                REQUIRE(get_raw_data<TestType>(ccopy).data() == pdata);
+            }
+
+            SECTION("Operation overwriting the copy") {
+                copy.permute_assignment(ij, matrix("j,i"));
+                REQUIRE(get_raw_data<TestType>(ccopy).data() != pdata);
+                REQUIRE(copy.get_elem({0, 1}) == three);
+                REQUIRE(matrix.get_elem({0, 1}) == two);
+            }
+
+            SECTION("Copies of buffers with mutable views") {
+                auto data = get_raw_data<TestType>(matrix);
+                Contiguous view_copy(matrix);
+                data[0] = four;
+                REQUIRE(matrix.get_elem({0, 0}) == four);
+                REQUIRE(view_copy.get_elem({0, 0}) == one);
+
+                Contiguous assigned;
+                assigned = matrix;
+                data[0] = one;
+                REQUIRE(assigned.get_elem({0, 0}) == four);
+
+                // Once matrix has new elements, copies share them again
+                matrix = view_copy;
+                Contiguous shared(matrix);
+                const auto& cshared = shared;
+                REQUIRE(get_raw_data<TestType>(cshared).data() ==
+                        get_raw_data<TestType>(cmatrix).data());
+            }
+
+            SECTION("Operation reading the copy") {
+                copy.multiplication_accumulation(ij, copy(ik), copy(kj));
+                REQUIRE(get_raw_data<TestType>(ccopy).data() != pdata);
+                REQUIRE(copy.get_elem({0, 0}) == TestType(8.0));
+                REQUIRE(matrix.get_elem({0, 0}) == one);
+            }
+        }
     }
 
     SECTION("shape") {
@@ -253,6 +327,228 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
         REQUIRE(matrix_slice.get_elem({0, 1}) == four);
     }
 
+    SECTION("slices in the DSL") {
+        // 3 by 3 matrix with elements 1, 2, ..., 9. The block is the top
+        // right 2 by 2 block, i.e., {{2, 3}, {5, 6}}
+        std::vector<TestType> data9;
+        for(int i = 1; i <= 9; ++i) data9.push_back(TestType(i));
+        Contiguous matrix9(data9, shape_type({3, 3}));
+        TestType five(5.0), six(6.0);
+        Contiguous copied(std::vector{two, three, five, six}, matrix_shape);
+
+        const auto block = matrix9.slice({0, 1}, {2, 3});
+
+        SECTION("lhs of a contraction") {
+            Contiguous result, corr;
+            result("i,j") = block("i,a") * matrix("a,j");
+            corr("i,j")   = copied("i,a") * matrix("a,j");
+            REQUIRE(result == corr);
+        }
+
+        SECTION("rhs of a contraction, transposed") {
+            Contiguous result, corr;
+            result("i,j") = matrix("i,a") * block("j,a");
+            corr("i,j")   = matrix("i,a") * copied("j,a");
+            REQUIRE(result == corr);
+        }
+
+        SECTION("both operands") {
+            Contiguous result, corr;
+            result("i,j") = block("a,i") * block("a,j");
+            corr("i,j")   = copied("a,i") * copied("a,j");
+            REQUIRE(result == corr);
+        }
+
+        SECTION("scaled and accumulated") {
+            Contiguous result(matrix), corr(matrix);
+            result("i,j") += 2.0 * (block("i,a") * matrix("a,j"));
+            corr("i,j") += 2.0 * (copied("i,a") * matrix("a,j"));
+            REQUIRE(result == corr);
+        }
+
+        SECTION("other operations") {
+            Contiguous result;
+            result("i,j") = block("i,j") + block("j,i");
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(4.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(8.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(8.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(12.0));
+        }
+
+        SECTION("sees the current elements") {
+            Contiguous result, corr;
+            result("i,j") = block("i,a") * matrix("a,j");
+            matrix9.set_elem({0, 1}, TestType(0.0));
+            copied.set_elem({0, 0}, TestType(0.0));
+            result("i,j") = block("i,a") * matrix("a,j");
+            corr("i,j")   = copied("i,a") * matrix("a,j");
+            REQUIRE(result == corr);
+        }
+
+        SECTION("sliced buffer is unchanged") {
+            Contiguous result;
+            result("i,j") = block("i,a") * matrix("a,j");
+            REQUIRE(matrix9 == Contiguous(data9, shape_type({3, 3})));
+        }
+    }
+
+    SECTION("non-row-major layouts") {
+        // matrix, i.e., {{1, 2}, {3, 4}}, in column-major order and row-major
+        // order with each row padded by one element
+        buffer_type col_buf(std::vector{one, three, two, four});
+        TestType pad(0.0);
+        buffer_type pad_buf(std::vector{one, two, pad, three, four});
+        layout::Physical col_layout(matrix_shape,
+                                    layout::StorageOrder::column_major);
+        layout::Physical pad_layout(matrix_shape,
+                                    layout::StorageOrder::row_major, 1);
+
+        Contiguous col(col_buf, col_layout);
+        Contiguous padded(pad_buf, pad_layout);
+
+        SECTION("Ctor") {
+            REQUIRE(col.shape() == matrix_shape);
+            REQUIRE(col.size() == 4);
+            REQUIRE(col.layout() == col_layout);
+            REQUIRE(col.get_elem({0, 1}) == two);
+            REQUIRE(col.get_elem({1, 0}) == three);
+            REQUIRE(col.layout() == col_layout); // Reading kept the layout
+
+            REQUIRE(padded.size() == 4);
+            REQUIRE(padded.get_elem({1, 0}) == three);
+            REQUIRE(padded.get_elem({1, 1}) == four);
+
+            // Row-major layouts must match exactly, others must fit
+            layout::Physical row_layout(matrix_shape);
+            using except_t = std::invalid_argument;
+            REQUIRE_THROWS_AS(Contiguous(pad_buf, row_layout), except_t);
+            REQUIRE_THROWS_AS(Contiguous(buffer_type(std::vector{one, two}),
+                                         col_layout),
+                              except_t);
+        }
+
+        SECTION("Equal to the row-major buffer") {
+            REQUIRE(col == matrix);
+            REQUIRE(padded == matrix);
+            REQUIRE(matrix == col);
+            REQUIRE(col == padded);
+            REQUIRE_FALSE(col == Contiguous(std::vector{one, two, three, one},
+                                            matrix_shape));
+
+            // Comparing them did not change how they are stored
+            REQUIRE(col.layout() == col_layout);
+            REQUIRE(padded.layout() == pad_layout);
+        }
+
+        SECTION("Views are laid out as the layout says") {
+            const auto& ccol = col;
+            auto pdata       = ccol.get_immutable_data();
+            REQUIRE(pdata.at(1) == three);
+            REQUIRE(ccol.infinity_norm() == four);
+            REQUIRE(col.layout() == col_layout);
+
+            auto pmutable = col.get_mutable_data();
+            pmutable.at(1) = TestType(42.0);
+            REQUIRE(col.get_elem({1, 0}) == TestType(42.0));
+            REQUIRE(col.layout() == col_layout);
+        }
+
+        SECTION("Writing elements keeps the layout") {
+            padded.set_elem({1, 0}, TestType(42.0));
+            REQUIRE(padded.get_elem({1, 0}) == TestType(42.0));
+            REQUIRE(padded.get_immutable_data().at(3) == TestType(42.0));
+
+            Contiguous block(std::vector{TestType(5.0), TestType(6.0)},
+                             shape_type({1, 2}));
+            col.assign_block({1, 0}, block);
+            REQUIRE(col.get_elem({1, 0}) == TestType(5.0));
+            REQUIRE(col.get_elem({1, 1}) == TestType(6.0));
+            REQUIRE(col.layout() == col_layout);
+
+            auto copy = col.copy_block({0, 0}, {2, 2});
+            REQUIRE(copy.layout().is_row_major());
+            REQUIRE(copy.get_immutable_data().at(1) == two);
+        }
+
+        SECTION("Results are row-major") {
+            Contiguous corr;
+            corr("i,j") = matrix("j,i");
+            col("i,j")  = col("j,i");
+            REQUIRE(col == corr);
+            REQUIRE(col.layout().is_row_major());
+            REQUIRE(col.get_immutable_data().at(1) == three);
+
+            corr("i,j")   = matrix("i,j") + matrix("i,j");
+            padded("i,j") = padded("i,j") + padded("i,j");
+            REQUIRE(padded == corr);
+            REQUIRE(padded.layout().is_row_major());
+        }
+
+        SECTION("Accumulating into a non-row-major buffer") {
+            Contiguous corr(matrix);
+            corr("i,j") += matrix("i,a") * matrix("a,j");
+            col("i,j") += matrix("i,a") * matrix("a,j");
+            REQUIRE(col == corr);
+            REQUIRE(col.layout() == col_layout);
+        }
+
+        SECTION("Contractions") {
+            Contiguous result, corr;
+            result("i,j") = col("i,a") * padded("a,j");
+            corr("i,j")   = matrix("i,a") * matrix("a,j");
+            REQUIRE(result == corr);
+            REQUIRE(result.layout().is_row_major());
+
+            // The operands still hold their original elements
+            REQUIRE(padded.get_elem({0, 1}) == two);
+        }
+
+        SECTION("Contractions of permuted modes") {
+            Contiguous result, corr;
+            result("i,j") = col("i,a") * col("j,a");
+            corr("i,j")   = matrix("i,a") * matrix("j,a");
+            REQUIRE(result == corr);
+
+            // T(i,a,j,b) stored with a and b fastest varying
+            shape_type t_shape({2, 3, 2, 3});
+            std::vector<TestType> t_dense(36), t_storage(36);
+            for(std::size_t i = 0; i < 2; ++i)
+                for(std::size_t a = 0; a < 3; ++a)
+                    for(std::size_t j = 0; j < 2; ++j)
+                        for(std::size_t b = 0; b < 3; ++b) {
+                            TestType value(18 * i + 6 * a + 3 * j + b);
+                            t_dense[18 * i + 6 * a + 3 * j + b] = value;
+                            t_storage[18 * i + 3 * a + 9 * j + b] = value;
+                        }
+            layout::Physical::stride_vector t_strides{18, 3, 9, 1};
+            layout::Physical t_layout(t_shape, t_strides);
+            Contiguous t(buffer_type(t_storage), t_layout);
+            Contiguous t_corr(t_dense, t_shape);
+
+            std::vector<TestType> v_data(18);
+            for(std::size_t i = 0; i < 18; ++i) v_data[i] = TestType(i);
+            Contiguous v(v_data, shape_type({3, 3, 2}));
+
+            Contiguous t_result, t_expected;
+            t_result("i,j,c")   = t("i,a,j,b") * v("a,b,c");
+            t_expected("i,j,c") = t_corr("i,a,j,b") * v("a,b,c");
+            REQUIRE(t_result == t_expected);
+            REQUIRE(t.layout() == t_layout);
+
+            t_result("i,j,c") += t("i,a,j,b") * v("a,b,c");
+            t_expected("i,j,c") += t_corr("i,a,j,b") * v("a,b,c");
+            REQUIRE(t_result == t_expected);
+        }
+
+        SECTION("Other operations") {
+            Contiguous result, corr;
+            result("i,j") = col("i,j") + padded("j,i");
+            corr("i,j")   = matrix("i,j") + matrix("j,i");
+            REQUIRE(result == corr);
+        }
+    }
+
     SECTION("infinity_norm") {
         REQUIRE_THROWS_AS(defaulted.infinity_norm(), std::runtime_error);
         REQUIRE(scalar.infinity_norm() == one);
@@ -260,6 +556,82 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
         REQUIRE(matrix.infinity_norm() == four);
     }
 
+    SECTION("block operations") {
+        auto matrix3x3 = [](std::vector<int> values) {
+            std::vector<TestType> elements;
+            for(auto value : values) elements.push_back(TestType(value));
+            return Contiguous(std::move(elements), shape_type({3, 3}));
+        };
+        const auto matrix9_corr = matrix3x3({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        auto matrix9            = matrix9_corr;
+        TestType zero(0.0), five(5.0), six(6.0);
+        using except_t = std::out_of_range;
+
+        SECTION("copy_block") {
+            auto block = matrix9.copy_block({0, 1}, {2, 3});
+            Contiguous corr(std::vector{two, three, five, six}, matrix_shape);
+            REQUIRE(block == corr);
+
+            // The copy is independent of matrix9
+            block.set_elem({0, 0}, zero);
+            REQUIRE(matrix9 == matrix9_corr);
+
+            REQUIRE(matrix9.copy_block({0, 0}, {3, 3}) == matrix9);
+            REQUIRE(vector.copy_block({1}, {3}) ==
+                    Contiguous(std::vector{two, three}, shape_type({2})));
+            REQUIRE(scalar.copy_block({}, {}) == scalar);
+            REQUIRE(matrix9.copy_block({1, 1}, {1, 3}).size() == 0);
+
+            REQUIRE_THROWS_AS(matrix9.copy_block({0}, {2}), except_t);
+            REQUIRE_THROWS_AS(matrix9.copy_block({0, 0}, {2}), except_t);
+            REQUIRE_THROWS_AS(matrix9.copy_block({2, 0}, {1, 2}), except_t);
+            REQUIRE_THROWS_AS(matrix9.copy_block({0, 0}, {4, 2}), except_t);
+        }
+
+        SECTION("assign_block") {
+            matrix9.assign_block({1, 1}, matrix);
+            REQUIRE(matrix9 == matrix3x3({1, 2, 3, 4, 1, 2, 7, 3, 4}));
+
+            // The source block need not be dense
+            Contiguous result = buffer::make_contiguous<TestType>(matrix_shape);
+            result.assign_block({0, 0}, matrix9.copy_block({0, 1}, {2, 3}));
+            REQUIRE(result == Contiguous(std::vector{two, three, one, two},
+                                         matrix_shape));
+
+            // Copies of *this are not modified
+            Contiguous copy(matrix);
+            Contiguous zero_block(std::vector{zero}, shape_type({1, 1}));
+            matrix.assign_block({0, 0}, zero_block);
+            REQUIRE(copy == Contiguous(data, matrix_shape));
+            REQUIRE(matrix.get_elem({0, 0}) == zero);
+
+            REQUIRE_THROWS_AS(matrix9.assign_block({2, 2}, matrix), except_t);
+            REQUIRE_THROWS_AS(matrix9.assign_block({0}, vector), except_t);
+            REQUIRE_THROWS_AS(matrix9.assign_block({0, 0}, vector), except_t);
+        }
+
+        SECTION("assign_block with a different type") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_type = std::conditional_t<is_float, double, float>;
+            Contiguous other(std::vector<other_type>(4), matrix_shape);
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(matrix9.assign_block({0, 0}, other), error_t);
+            REQUIRE(matrix9 == matrix9_corr);
+        }
+
+        SECTION("accumulate_block") {
+            matrix9.accumulate_block({0, 1}, matrix);
+            REQUIRE(matrix9 == matrix3x3({1, 3, 5, 4, 8, 10, 7, 8, 9}));
+
+            matrix.accumulate_block({0, 0}, matrix, -1.0);
+            REQUIRE(matrix ==
+                    Contiguous(std::vector<TestType>(4, zero), matrix_shape));
+
+            REQUIRE_THROWS_AS(matrix9.accumulate_block({0, 2}, matrix),
+                              except_t);
+        }
+    }
+
     SECTION("operator==") {
         // Same object
         REQUIRE(defaulted == defaulted);
@@ -288,6 +660,19 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
         REQUIRE_FALSE(scalar == scalar_diff);
         REQUIRE_FALSE(vector == Contiguous(diff_data, vector_shape));
         REQUIRE_FALSE(matrix == Contiguous(diff_data, matrix_shape));
+
+        // Copies sharing their elements
+        auto vector_shared = vector;
+        REQUIRE(vector == vector_shared);
+
+        // Large enough to be compared in several chunks
+        const std::size_t n = (std::size_t{3} << 20) / sizeof(double);
+        shape_type big_shape({n});
+        std::vector<TestType> big_data(n, one);
+        Contiguous big(big_data, big_shape);
+        REQUIRE(big == Contiguous(big_data, big_shape));
+        big_data.back() = two;
+        REQUIRE_FALSE(big == Contiguous(big_data, big_shape));
     }
 
     SECTION("approximately_equal") {
@@ -445,6 +830,85 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
             REQUIRE(result.get_elem({1, 0}) == TestType(9.0));
             REQUIRE(result.get_elem({1, 1}) == TestType(16.0));
         }
+
+        SECTION("scaled") {
+            label_type ij("i,j");
+            label_type ik("i,k");
+            label_type kj("k,j");
+            Contiguous result;
+            result.multiplication_assignment(ij, 2.0, matrix(ik), matrix(kj));
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(14.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(20.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(30.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(44.0));
+        }
+    }
+
+    SECTION("multiplication_accumulation_") {
+        label_type ij("i,j");
+        label_type ik("i,k");
+        label_type kj("k,j");
+
+        SECTION("hadamard") {
+            Contiguous result(matrix);
+            result.multiplication_accumulation(ij, matrix(ij), matrix(ij));
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(2.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(6.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(12.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(20.0));
+        }
+
+        SECTION("contraction") {
+            Contiguous result(matrix);
+            result.multiplication_accumulation(ij, matrix(ik), matrix(kj));
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(8.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(12.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(18.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(26.0));
+        }
+
+        SECTION("scaled") {
+            Contiguous result(matrix);
+            result.multiplication_accumulation(ij, -1.0, matrix(ik),
+                                               matrix(kj));
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(-6.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(-8.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(-12.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(-18.0));
+        }
+
+        SECTION("in place") {
+            matrix.multiplication_accumulation(ij, matrix(ik), matrix(kj));
+            REQUIRE(matrix.get_elem({0, 0}) == TestType(8.0));
+            REQUIRE(matrix.get_elem({0, 1}) == TestType(12.0));
+            REQUIRE(matrix.get_elem({1, 0}) == TestType(18.0));
+            REQUIRE(matrix.get_elem({1, 1}) == TestType(26.0));
+        }
+
+        SECTION("product has a different shape") {
+            Contiguous result(data, shape_type({1, 4}));
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(
+              result.multiplication_accumulation(ij, matrix(ik), matrix(kj)),
+              error_t);
+        }
+
+        SECTION("result holds a different type") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+
+            using other_type = std::conditional_t<is_float, double, float>;
+
+            std::vector<other_type> zeros(4, other_type(0.0));
+            Contiguous result(std::move(zeros), matrix_shape);
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(
+              result.multiplication_accumulation(ij, matrix(ik), matrix(kj)),
+              error_t);
+        }
     }
 
     SECTION("scalar_multiplication_") {
@@ -485,6 +949,56 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
         }
     }
 
+    SECTION("linear_combination_assignment_") {
+        using terms_type = typename Contiguous::linear_terms_type;
+        SECTION("scalar") {
+            label_type labels("");
+            Contiguous result;
+            terms_type terms{{2.0, scalar(labels)}, {-1.0, scalar(labels)}};
+            result.linear_combination_assignment(labels, terms);
+            REQUIRE(result.shape() == scalar_shape);
+            REQUIRE(result.get_elem({}) == TestType(1.0));
+        }
+
+        SECTION("matrix") {
+            label_type ij("i,j");
+            label_type ji("j,i");
+            Contiguous result;
+            terms_type terms{{1.0, matrix(ij)}, {2.0, matrix(ji)}};
+            result.linear_combination_assignment(ij, terms);
+            REQUIRE(result.shape() == matrix_shape);
+            REQUIRE(result.get_elem({0, 0}) == TestType(3.0));
+            REQUIRE(result.get_elem({0, 1}) == TestType(8.0));
+            REQUIRE(result.get_elem({1, 0}) == TestType(7.0));
+            REQUIRE(result.get_elem({1, 1}) == TestType(12.0));
+        }
+
+        SECTION("accumulate in place") {
+            label_type ij("i,j");
+            label_type ji("j,i");
+            Contiguous other(data, matrix_shape);
+            terms_type terms{{2.0, matrix(ij)}, {1.0, other(ji)}};
+            auto pdata = buffer::get_raw_data<TestType>(matrix).data();
+            matrix.linear_combination_assignment(ij, terms);
+            REQUIRE(matrix.get_elem({0, 0}) == TestType(3.0));
+            REQUIRE(matrix.get_elem({0, 1}) == TestType(7.0));
+            REQUIRE(matrix.get_elem({1, 0}) == TestType(8.0));
+            REQUIRE(matrix.get_elem({1, 1}) == TestType(12.0));
+            REQUIRE(buffer::get_raw_data<TestType>(matrix).data() == pdata);
+        }
+
+        SECTION("in place") {
+            label_type ij("i,j");
+            label_type ji("j,i");
+            terms_type terms{{1.0, matrix(ij)}, {-1.0, matrix(ji)}};
+            matrix.linear_combination_assignment(ij, terms);
+            REQUIRE(matrix.get_elem({0, 0}) == TestType(0.0));
+            REQUIRE(matrix.get_elem({0, 1}) == TestType(-1.0));
+            REQUIRE(matrix.get_elem({1, 0}) == TestType(1.0));
+            REQUIRE(matrix.get_elem({1, 1}) == TestType(0.0));
+        }
+    }
+
     SECTION("permute_assignment_") {
         SECTION("scalar") {
             label_type labels("");
@@ -516,6 +1030,22 @@ TEMPLATE_LIST_TEST_CASE("Contiguous", "", types::floating_point_types) {
             REQUIRE(result.get_elem({1, 0}) == TestType(2.0));
             REQUIRE(result.get_elem({1, 1}) == TestType(4.0));
         }
+
+        SECTION("result holds a different type") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+
+            using other_type = std::conditional_t<is_float, double, float>;
+
+            label_type labels("i");
+            std::vector<other_type> zeros(4, other_type(0.0));
+            Contiguous result(std::move(zeros), vector_shape);
+            result.permute_assignment(labels, vector(labels));
+            REQUIRE(result.shape() == vector_shape);
+            REQUIRE(result.get_elem({0}) == TestType(1.0));
+            REQUIRE(result.get_elem({1}) == TestType(2.0));
+            REQUIRE(result.get_elem({2}) == TestType(3.0));
+            REQUIRE(result.get_elem({3}) == TestType(4.0));
+        }
     }
 
     SECTION("to_string") {
@@ -593,6 +1123,30 @@ TEMPLATE_LIST_TEST_CASE("make_contiguous(shape, value)", "",
     REQUIRE(contig == corr);
 }
 
+TEMPLATE_LIST_TEST_CASE("make_contiguous(shape, policy)", "",
+                        types::floating_point_types) {
+    using buffer::Contiguous;
+    using shape_type = shape::Smooth;
+
+    buffer::AllocationPolicy policy{true, true, 0};
+    shape_type shape({2, 2});
+
+    SECTION("zero-initialized") {
+        std::vector<TestType> data(4, TestType{0.0});
+        buffer::Contiguous corr(data, shape);
+        Contiguous contig = buffer::make_contiguous<TestType>(shape, policy);
+        REQUIRE(contig == corr);
+    }
+
+    SECTION("value") {
+        TestType init{42.0};
+        std::vector<TestType> data(4, init);
+        buffer::Contiguous corr(data, shape);
+        Contiguous contig = buffer::make_contiguous(shape, init, policy);
+        REQUIRE(contig == corr);
+    }
+}
+
 TEST_CASE("interval contraction") {
 #ifdef ENABLE_SIGMA
     using interval_type = sigma::Interval<double>;
@@ -51,6 +51,12 @@ TEST_CASE("ContractionPlanner") {
     ContractionPlanner cp_il_ijk_jkl("i,l", "i,j,k", "j,k,l");
     ContractionPlanner cp_il_ijk_klj("i,l", "i,j,k", "k,l,j");
 
+    // Free/dummy indices which are (not) contiguous
+    ContractionPlanner cp_lji_ik_kjl("l,j,i", "i,k", "k,j,l");
+    ContractionPlanner cp_lij_ik_kjl("l,i,j", "i,k", "k,j,l");
+    ContractionPlanner cp_i_jik_kj("i", "j,i,k", "k,j");
+    ContractionPlanner cp_il_jik_klj("i,l", "j,i,k", "k,l,j");
+
     SECTION("Ctors") {
         using error_t = std::runtime_error;
 
@@ -246,4 +252,71 @@ TEST_CASE("ContractionPlanner") {
         REQUIRE(cp_il_ijk_jkl.result_matrix_labels() == "i,l");
         REQUIRE(cp_il_ijk_klj.result_matrix_labels() == "i,l");
     }
+
+    SECTION("gemm_row_labels") {
+        REQUIRE(cp___.gemm_row_labels() == "");
+
+        REQUIRE(cp__i_i.gemm_row_labels() == "");
+        REQUIRE(cp_ij_i_j.gemm_row_labels() == "i");
+        REQUIRE(cp_ji_i_j.gemm_row_labels() == "i");
+
+        REQUIRE(cp_j_i_ij.gemm_row_labels() == "");
+        REQUIRE(cp_ijk_i_kj.gemm_row_labels() == "i");
+
+        REQUIRE(cp_ji_ik_jk.gemm_row_labels() == "i");
+
+        REQUIRE(cp_j_ki_jki.gemm_row_labels() == "");
+        REQUIRE(cp_jil_ki_jkl.gemm_row_labels() == "i");
+
+        REQUIRE(cp__ijk_jik.gemm_row_labels() == "");
+        REQUIRE(cp_il_ijk_klj.gemm_row_labels() == "i");
+
+        REQUIRE(cp_lji_ik_kjl.gemm_row_labels() == "i");
+        REQUIRE(cp_lij_ik_kjl.gemm_row_labels() == "i");
+    }
+
+    SECTION("gemm_col_labels") {
+        REQUIRE(cp___.gemm_col_labels() == "");
+
+        REQUIRE(cp__i_i.gemm_col_labels() == "");
+        REQUIRE(cp_ij_i_j.gemm_col_labels() == "j");
+        REQUIRE(cp_ji_i_j.gemm_col_labels() == "j");
+
+        REQUIRE(cp_j_i_ji.gemm_col_labels() == "j");
+        REQUIRE(cp_ijk_i_kj.gemm_col_labels() == "j,k");
+
+        REQUIRE(cp_ji_ik_jk.gemm_col_labels() == "j");
+
+        REQUIRE(cp_j_ki_jki.gemm_col_labels() == "j");
+        REQUIRE(cp_jil_ki_jkl.gemm_col_labels() == "j,l");
+
+        REQUIRE(cp__ijk_jik.gemm_col_labels() == "");
+        REQUIRE(cp_il_ijk_klj.gemm_col_labels() == "l");
+
+        // Result order when contiguous in result, RHS order otherwise
+        REQUIRE(cp_lji_ik_kjl.gemm_col_labels() == "l,j");
+        REQUIRE(cp_lij_ik_kjl.gemm_col_labels() == "j,l");
+    }
+
+    SECTION("gemm_sum_labels") {
+        REQUIRE(cp___.gemm_sum_labels() == "");
+
+        REQUIRE(cp__i_i.gemm_sum_labels() == "i");
+        REQUIRE(cp_ij_i_j.gemm_sum_labels() == "");
+
+        REQUIRE(cp_j_i_ji.gemm_sum_labels() == "i");
+        REQUIRE(cp_ijk_i_kj.gemm_sum_labels() == "");
+
+        REQUIRE(cp_ji_ik_jk.gemm_sum_labels() == "k");
+
+        REQUIRE(cp_j_ki_jki.gemm_sum_labels() == "k,i");
+        REQUIRE(cp_jil_ki_jkl.gemm_sum_labels() == "k");
+
+        REQUIRE(cp__ijk_jik.gemm_sum_labels() == "i,j,k");
+        REQUIRE(cp_il_ijk_klj.gemm_sum_labels() == "j,k");
+
+        // RHS order if only RHS is contiguous, LHS order otherwise
+        REQUIRE(cp_i_jik_kj.gemm_sum_labels() == "k,j");
+        REQUIRE(cp_il_jik_klj.gemm_sum_labels() == "j,k");
+    }
 }
@@ -192,12 +192,16 @@ TEMPLATE_LIST_TEST_CASE("MultiplicationVisitor", "[buffer][detail_]",
     SECTION("existing buffer: batched contraction") {
         buffer_type this_buffer(this_data);
         shape_type out_shape({2});
+        shape_type in_shape({2, 2});
         label_type lhs_labels("a,i");
         label_type rhs_labels("i,a");
-        VisitorType visitor(this_buffer, labels, out_shape, lhs_labels, shape,
-                            rhs_labels, shape);
+        VisitorType visitor(this_buffer, labels, out_shape, lhs_labels,
+                            in_shape, rhs_labels, in_shape);
 
-        REQUIRE_THROWS_AS(visitor(lhs_span, rhs_span), std::runtime_error);
+        visitor(lhs_span, rhs_span);
+        REQUIRE(this_buffer.size() == 2);
+        REQUIRE(this_buffer.at(0) == TestType(6.0));
+        REQUIRE(this_buffer.at(1) == TestType(4.0));
     }
 
     SECTION("non-existing buffer") {
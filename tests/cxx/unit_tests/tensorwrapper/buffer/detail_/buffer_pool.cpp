@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../testing/testing.hpp"
+#include <tensorwrapper/buffer/contiguous.hpp>
+#include <tensorwrapper/buffer/detail_/buffer_pool.hpp>
+
+using namespace tensorwrapper;
+using buffer::detail_::BufferPool;
+
+TEST_CASE("BufferPool") {
+    using buffer_type = BufferPool::buffer_type;
+
+    auto& pool           = BufferPool::instance();
+    const auto old_limit = pool.limit();
+    pool.clear();
+    pool.set_limit(10 * sizeof(double));
+
+    auto make_buffer = [](std::size_t n) {
+        return buffer_type(std::vector<double>(n, 1.0));
+    };
+
+    SECTION("Disabled") {
+        pool.set_limit(0);
+        pool.release(make_buffer(2));
+        REQUIRE_FALSE(pool.acquire<double>(2).has_value());
+        REQUIRE(pool.stats().bytes_retained == 0);
+        REQUIRE(pool.stats().misses == 0);
+    }
+
+    SECTION("Miss") {
+        REQUIRE_FALSE(pool.acquire<double>(2).has_value());
+        REQUIRE(pool.stats().misses == 1);
+        REQUIRE(pool.stats().hits == 0);
+    }
+
+    SECTION("Hit") {
+        auto buffer = make_buffer(2);
+        const auto* pdata =
+          wtf::buffer::contiguous_buffer_cast<double>(buffer).data();
+        pool.release(std::move(buffer));
+        REQUIRE(pool.stats().bytes_retained == 2 * sizeof(double));
+
+        // Only the same type and size gets the buffer
+        REQUIRE_FALSE(pool.acquire<double>(3).has_value());
+        REQUIRE_FALSE(pool.acquire<float>(2).has_value());
+
+        auto pbuffer = pool.acquire<double>(2);
+        REQUIRE(pbuffer.has_value());
+        auto data = wtf::buffer::contiguous_buffer_cast<double>(*pbuffer);
+        REQUIRE(data.data() == pdata);
+
+        auto stats = pool.stats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 2);
+        REQUIRE(stats.bytes_retained == 0);
+        REQUIRE(stats.high_water_mark == 2 * sizeof(double));
+    }
+
+    SECTION("Limit") {
+        pool.release(make_buffer(4));
+        pool.release(make_buffer(4));
+        REQUIRE(pool.stats().bytes_retained == 8 * sizeof(double));
+
+        // The oldest buffer is freed to make room
+        pool.release(make_buffer(3));
+        REQUIRE(pool.stats().bytes_retained == 7 * sizeof(double));
+        REQUIRE(pool.stats().high_water_mark == 8 * sizeof(double));
+
+        // Too big to ever be pooled
+        pool.release(make_buffer(11));
+        REQUIRE(pool.stats().bytes_retained == 7 * sizeof(double));
+
+        // Lowering the limit frees buffers
+        pool.set_limit(3 * sizeof(double));
+        REQUIRE(pool.stats().bytes_retained == 3 * sizeof(double));
+        REQUIRE(pool.acquire<double>(3).has_value());
+    }
+
+    SECTION("Requests the allocation policy applies to bypass the pool") {
+        const auto old_policy = buffer::default_allocation_policy();
+        buffer::AllocationPolicy policy;
+        policy.huge_pages = true;
+        policy.min_bytes  = 3 * sizeof(double);
+        buffer::set_default_allocation_policy(policy);
+
+        pool.release(make_buffer(2));
+        pool.release(make_buffer(3));
+        const bool small_hit = pool.acquire<double>(2).has_value();
+        const bool large_hit = pool.acquire<double>(3).has_value();
+        buffer::set_default_allocation_policy(old_policy);
+
+        // Too small for the policy to apply, so the pool is used
+        REQUIRE(small_hit);
+        REQUIRE_FALSE(large_hit);
+        REQUIRE(pool.acquire<double>(3).has_value());
+    }
+
+    SECTION("clear") {
+        pool.release(make_buffer(4));
+        pool.clear();
+        REQUIRE(pool.stats().bytes_retained == 0);
+        REQUIRE(pool.stats().high_water_mark == 0);
+        REQUIRE_FALSE(pool.acquire<double>(4).has_value());
+    }
+
+    SECTION("Contiguous recycles its elements") {
+        shape::Smooth shape{2, 2};
+        const double* pdata = nullptr;
+        {
+            auto temp         = buffer::make_contiguous<double>(shape);
+            const auto& ctemp = temp;
+            pdata             = buffer::get_raw_data<double>(ctemp).data();
+
+            // Shared elements are not recycled
+            auto copy = temp;
+        }
+        REQUIRE(pool.stats().bytes_retained == 4 * sizeof(double));
+
+        // A new buffer of the same size reuses the memory, zeroed
+        auto guide         = buffer::make_contiguous<double>(shape::Smooth{1});
+        auto reuse         = buffer::make_contiguous(guide, shape);
+        const auto& creuse = reuse;
+        REQUIRE(buffer::get_raw_data<double>(creuse).data() == pdata);
+        REQUIRE(reuse.get_elem({1, 1}) == 0.0);
+    }
+
+    pool.clear();
+    pool.set_limit(old_limit);
+}
+
+TEST_CASE("buffer_pool_stats") {
+    buffer::clear_buffer_pool();
+    const auto old_limit = buffer::buffer_pool_limit();
+
+    buffer::set_buffer_pool_limit(1024);
+    REQUIRE(buffer::buffer_pool_limit() == 1024);
+
+    auto stats = buffer::buffer_pool_stats();
+    REQUIRE(stats.hits == 0);
+    REQUIRE(stats.misses == 0);
+    REQUIRE(stats.bytes_retained == 0);
+    REQUIRE(stats.high_water_mark == 0);
+
+    buffer::set_buffer_pool_limit(old_limit);
+}
@@ -56,3 +56,64 @@ TEMPLATE_LIST_TEST_CASE("hash_input", "", types::floating_point_types) {
         REQUIRE(seed == corr);
     }
 }
+
+TEST_CASE("hash_bytes") {
+    using buffer::detail_::hash_utilities::hash_bytes;
+    auto hash = [](std::string_view s, std::uint64_t seed = 0) {
+        auto* p = reinterpret_cast<const std::byte*>(s.data());
+        return hash_bytes(p, s.size(), seed);
+    };
+
+    // Reference values of the 64-bit xxHash
+    REQUIRE(hash("") == 0xEF46DB3751D8E999ull);
+    REQUIRE(hash("abc") == 0x44BC2CF5AD770999ull);
+    REQUIRE(hash("Nobody inspects the spammish repetition") ==
+            0xFBCEA83C8A378BF1ull);
+
+    // The seed matters
+    REQUIRE(hash("abc", 1) != hash("abc"));
+}
+
+TEST_CASE("hash_elements") {
+    using namespace buffer::detail_::hash_utilities;
+
+    SECTION("One chunk") {
+        std::vector<double> data{1.0, 2.0, 3.0};
+        std::span<const double> span(data);
+        auto* p = reinterpret_cast<const std::byte*>(data.data());
+        REQUIRE(hash_elements(span, 42) ==
+                hash_bytes(p, 3 * sizeof(double), 42));
+    }
+
+    SECTION("Several chunks") {
+        // Two full chunks and a partial chunk
+        const auto n = (2 * hash_chunk_bytes + 24) / sizeof(double);
+        std::vector<double> data(n);
+        for(std::size_t i = 0; i < n; ++i) data[i] = i;
+        std::span<const double> span(data);
+
+        auto* p = reinterpret_cast<const std::byte*>(data.data());
+        std::vector<std::uint64_t> chunks{
+          hash_bytes(p, hash_chunk_bytes, 0),
+          hash_bytes(p + hash_chunk_bytes, hash_chunk_bytes, 0),
+          hash_bytes(p + 2 * hash_chunk_bytes, 24, 0)};
+        auto* pchunks = reinterpret_cast<const std::byte*>(chunks.data());
+        const auto corr = hash_bytes(pchunks, 3 * sizeof(std::uint64_t), 0);
+        REQUIRE(hash_elements(span, 0) == corr);
+
+        // Any change is seen
+        data.back() = -1.0;
+        REQUIRE(hash_elements(span, 0) != corr);
+    }
+}
+
+TEST_CASE("HashVisitor") {
+    using buffer::detail_::hash_utilities::HashVisitor;
+    std::vector<double> data{1.0, 2.0};
+    std::span<const double> span(data);
+
+    HashVisitor visitor;
+    visitor(span);
+    REQUIRE(visitor.get_hash() ==
+            buffer::detail_::hash_utilities::hash_elements(span, 0));
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../testing/testing.hpp"
+#include <tensorwrapper/buffer/detail_/linear_combination_visitor.hpp>
+#include <tensorwrapper/types/floating_point.hpp>
+using namespace tensorwrapper;
+
+TEMPLATE_LIST_TEST_CASE("LinearCombinationVisitor", "[buffer][detail_]",
+                        types::floating_point_types) {
+    using VisitorType = buffer::detail_::LinearCombinationVisitor;
+    using buffer_type = typename VisitorType::buffer_type;
+    using label_type  = typename VisitorType::label_type;
+    using shape_type  = typename VisitorType::shape_type;
+    using term_vector = typename VisitorType::term_vector;
+
+    TestType one{1.0}, two{2.0}, three{3.0}, four{4.0};
+    std::vector<TestType> first_data{one, two, three, four};
+    std::vector<TestType> second_data{four, three, two, one};
+    shape_type shape({2, 2});
+    label_type ij("i,j");
+    label_type ji("j,i");
+
+    auto second = std::make_shared<const buffer_type>(second_data);
+    std::span<TestType> first_span(first_data.data(), first_data.size());
+    std::span<const TestType> cfirst_span(first_data.data(),
+                                          first_data.size());
+
+    term_vector terms{{1.0, ij, shape, nullptr}, {-2.0, ji, shape, second}};
+
+    SECTION("Ctor") {
+        buffer_type this_buffer;
+        VisitorType visitor(this_buffer, ij, shape, terms);
+        REQUIRE(visitor.this_labels() == ij);
+        REQUIRE(visitor.other_labels() == ij);
+        REQUIRE(visitor.terms().size() == 2);
+        REQUIRE(visitor.terms()[1].labels == ji);
+    }
+
+    SECTION("existing buffer") {
+        buffer_type this_buffer(std::vector<TestType>(4, TestType(0.0)));
+        VisitorType visitor(this_buffer, ij, shape, terms);
+
+        visitor(first_span);
+        REQUIRE(this_buffer.at(0) == TestType(-7.0));
+        REQUIRE(this_buffer.at(1) == TestType(-2.0));
+        REQUIRE(this_buffer.at(2) == TestType(-3.0));
+        REQUIRE(this_buffer.at(3) == TestType(2.0));
+    }
+
+    SECTION("non-existing buffer") {
+        buffer_type empty_buffer;
+        VisitorType visitor(empty_buffer, ij, shape, terms);
+
+        visitor(cfirst_span);
+        REQUIRE(empty_buffer.at(0) == TestType(-7.0));
+        REQUIRE(empty_buffer.at(1) == TestType(-2.0));
+        REQUIRE(empty_buffer.at(2) == TestType(-3.0));
+        REQUIRE(empty_buffer.at(3) == TestType(2.0));
+    }
+}
@@ -550,4 +550,26 @@ TEST_CASE("EinsumPlanner") {
             REQUIRE(ep_ijbk_bnilsk_bsammjl.rhs_batch() == "b");
         }
     }
+
+    SECTION("Removing batch indices") {
+        EinsumPlanner ep___("", "", "");
+        REQUIRE(ep___.result_nonbatch() == "");
+        REQUIRE(ep___.lhs_nonbatch() == "");
+        REQUIRE(ep___.rhs_nonbatch() == "");
+
+        EinsumPlanner ep_il_ij_jl("i,l", "i,j", "j,l");
+        REQUIRE(ep_il_ij_jl.result_nonbatch() == "i,l");
+        REQUIRE(ep_il_ij_jl.lhs_nonbatch() == "i,j");
+        REQUIRE(ep_il_ij_jl.rhs_nonbatch() == "j,l");
+
+        EinsumPlanner ep_lbqm_iqbj_iqbml("l,b,q,m", "i,q,b,j", "i,q,b,m,l");
+        REQUIRE(ep_lbqm_iqbj_iqbml.result_nonbatch() == "l,m");
+        REQUIRE(ep_lbqm_iqbj_iqbml.lhs_nonbatch() == "i,j");
+        REQUIRE(ep_lbqm_iqbj_iqbml.rhs_nonbatch() == "i,m,l");
+
+        EinsumPlanner ep_b_bii_b("b", "b,i,i", "b");
+        REQUIRE(ep_b_bii_b.result_nonbatch() == "");
+        REQUIRE(ep_b_bii_b.lhs_nonbatch() == "i,i");
+        REQUIRE(ep_b_bii_b.rhs_nonbatch() == "");
+    }
 }
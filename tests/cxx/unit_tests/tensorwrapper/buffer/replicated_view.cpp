@@ -139,4 +139,35 @@ TEST_CASE("ReplicatedView") {
         REQUIRE(const_matrix_slice.layout().shape().size() == 1);
         REQUIRE(const_matrix_slice.get_elem({0, 0}) == 2.0);
     }
+
+    SECTION("operator()") {
+        Contiguous corr(std::vector<TestType>{2.0, 4.0}, shape::Smooth{2, 1});
+
+        auto labeled = matrix_view("i,j");
+        REQUIRE(labeled.labels() == "i,j");
+        REQUIRE(labeled.object().are_equal(corr));
+
+        auto const_labeled = const_matrix_view("i,j");
+        REQUIRE(const_labeled.object().are_equal(corr));
+
+        // Sees changes to the viewed buffer
+        matrix.set_elem({1, 1}, 99.0);
+        corr.set_elem({1, 0}, 99.0);
+        REQUIRE(matrix_view("i,j").object().are_equal(corr));
+
+        view_type defaulted;
+        REQUIRE_THROWS_AS(defaulted("i"), std::runtime_error);
+    }
+
+    SECTION("operator() only shares the elements during the expression") {
+        Contiguous result;
+        result("i,j") = matrix_view("i,j") + matrix_view("i,j");
+
+        // The viewed buffer owns its elements again, so writing to them does
+        // not copy them
+        const auto* pdata = buffer::get_raw_data<TestType>(matrix).data();
+        matrix.set_elem({0, 0}, 42.0);
+        REQUIRE(buffer::get_raw_data<TestType>(matrix).data() == pdata);
+        REQUIRE(result.get_elem({0, 0}) == 4.0);
+    }
 }
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/buffer/typed_view.hpp>
+
+using namespace tensorwrapper;
+
+TEMPLATE_LIST_TEST_CASE("TypedView", "", types::floating_point_types) {
+    using buffer::Contiguous;
+    using buffer::TypedView;
+    using shape_type   = typename Contiguous::shape_type;
+    using index_vector = typename Contiguous::index_vector;
+    using view_type    = TypedView<TestType>;
+
+    // 2 by 3 matrix with elements 0, 1, ..., 5
+    std::vector<TestType> data;
+    for(int i = 0; i < 6; ++i) data.push_back(TestType(i));
+    Contiguous scalar(std::vector{TestType(1.0)}, shape_type({}));
+    Contiguous matrix(data, shape_type({2, 3}));
+
+    view_type defaulted;
+    auto scalar_view = buffer::make_typed_view<TestType>(scalar);
+    auto matrix_view = buffer::make_typed_view<TestType>(matrix);
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.rank() == 0);
+            REQUIRE(defaulted.size() == 0);
+        }
+
+        SECTION("Value") {
+            REQUIRE(scalar_view.rank() == 0);
+            REQUIRE(scalar_view.size() == 1);
+
+            REQUIRE(matrix_view.rank() == 2);
+            REQUIRE(matrix_view.extent(0) == 2);
+            REQUIRE(matrix_view.extent(1) == 3);
+            REQUIRE(matrix_view.size() == 6);
+
+            std::span<TestType> elements(data);
+            REQUIRE_THROWS_AS(view_type(elements, index_vector{2, 2}),
+                              std::invalid_argument);
+        }
+    }
+
+    SECTION("data") {
+        auto elements = buffer::get_raw_data<TestType>(matrix);
+        REQUIRE(matrix_view.data().data() == elements.data());
+        REQUIRE(matrix_view.data().size() == 6);
+    }
+
+    SECTION("operator()") {
+        REQUIRE(scalar_view() == TestType(1.0));
+        REQUIRE(matrix_view(0, 0) == TestType(0.0));
+        REQUIRE(matrix_view(0, 2) == TestType(2.0));
+        REQUIRE(matrix_view(1, 0) == TestType(3.0));
+        REQUIRE(matrix_view(1, 2) == TestType(5.0));
+
+        // Any integral type works as an index
+        REQUIRE(matrix_view(int{1}, std::size_t{1}) == TestType(4.0));
+
+        // Writes go to the buffer
+        matrix_view(1, 1) = TestType(42.0);
+        REQUIRE(matrix.get_elem({1, 1}) == TestType(42.0));
+    }
+
+    SECTION("for_each") {
+        std::vector<index_vector> indices;
+        std::vector<TestType> values;
+        matrix_view.for_each([&](const index_vector& index, TestType& value) {
+            indices.push_back(index);
+            values.push_back(value);
+            value = TestType(2.0) * value;
+        });
+        std::vector<index_vector> corr_indices{{0, 0}, {0, 1}, {0, 2},
+                                               {1, 0}, {1, 1}, {1, 2}};
+        REQUIRE(indices == corr_indices);
+        REQUIRE(values == data);
+        REQUIRE(matrix.get_elem({1, 2}) == TestType(10.0));
+
+        std::size_t ncalls = 0;
+        scalar_view.for_each([&](const index_vector& index, TestType&) {
+            REQUIRE(index.empty());
+            ++ncalls;
+        });
+        REQUIRE(ncalls == 1);
+
+        defaulted.for_each([&](const index_vector&, TestType&) { ++ncalls; });
+        REQUIRE(ncalls == 1);
+    }
+
+    SECTION("Views of shared buffers") {
+        Contiguous copy(matrix);
+        auto view = buffer::make_typed_view<TestType>(copy);
+        view(0, 0) = TestType(42.0);
+        REQUIRE(copy.get_elem({0, 0}) == TestType(42.0));
+        REQUIRE(matrix.get_elem({0, 0}) == TestType(0.0));
+    }
+
+    SECTION("Non-row-major layouts") {
+        // The matrix stored column-major
+        using buffer_type = typename Contiguous::buffer_type;
+        std::vector<TestType> col_data;
+        for(int i : {0, 3, 1, 4, 2, 5}) col_data.push_back(TestType(i));
+        layout::Physical col_layout(shape_type({2, 3}),
+                                    layout::StorageOrder::column_major);
+        Contiguous col(buffer_type(col_data), col_layout);
+
+        auto view = buffer::make_typed_view<TestType>(col);
+        REQUIRE(view.size() == 6);
+        REQUIRE(view(0, 1) == TestType(1.0));
+        REQUIRE(view(1, 0) == TestType(3.0));
+        REQUIRE(view(1, 2) == TestType(5.0));
+
+        // Elements are visited in storage order, with their logical indices
+        std::vector<TestType> values;
+        view.for_each([&](const index_vector& index, TestType& value) {
+            REQUIRE(value == TestType(index[0] * 3 + index[1]));
+            values.push_back(value);
+        });
+        REQUIRE(values == col_data);
+
+        view(1, 0) = TestType(42.0);
+        REQUIRE(col.get_elem({1, 0}) == TestType(42.0));
+
+        std::span<TestType> elements(data);
+        REQUIRE_THROWS_AS(view_type(elements, {2, 3}, {1, 3}),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(view_type(elements, {2, 3}, {1}),
+                          std::invalid_argument);
+    }
+
+    SECTION("Read-only views") {
+        const auto& cmatrix = matrix;
+        auto view           = buffer::make_typed_view<TestType>(cmatrix);
+        using const_view_type = TypedView<const TestType>;
+        STATIC_REQUIRE(std::is_same_v<decltype(view), const_view_type>);
+        REQUIRE(view(1, 2) == TestType(5.0));
+
+        TestType sum(0.0);
+        view.for_each(
+          [&](const index_vector&, const TestType& value) { sum += value; });
+        REQUIRE(sum == TestType(15.0));
+    }
+}
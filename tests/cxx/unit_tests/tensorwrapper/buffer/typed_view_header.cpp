@@ -0,0 +1,31 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// typed_view.hpp is included before anything else so that this TU checks
+// that the header is self-contained (and does not define TypedView twice)
+#include <tensorwrapper/buffer/typed_view.hpp>
+
+#include "../testing/testing.hpp"
+
+using namespace tensorwrapper;
+
+TEST_CASE("typed_view.hpp is self-contained") {
+    buffer::Contiguous matrix(std::vector{1.0, 2.0, 3.0, 4.0},
+                              shape::Smooth{2, 2});
+    auto view = buffer::make_typed_view<double>(matrix);
+    REQUIRE(view.rank() == 2);
+    REQUIRE(view(1, 0) == 3.0);
+}
@@ -68,6 +68,15 @@ TEMPLATE_LIST_TEST_CASE("DSLBase", "", test_types) {
             REQUIRE(&lvalue.object() == &value);
             REQUIRE(lvalue.labels() == "i,j");
         }
+
+        SECTION("lvalue") { REQUIRE_FALSE(value("i,j").is_expiring()); }
+
+        SECTION("rvalue") {
+            auto lvalue = std::move(value)("i,j");
+            REQUIRE(&lvalue.object() == &value);
+            REQUIRE(lvalue.labels() == "i,j");
+            REQUIRE(lvalue.is_expiring());
+        }
     }
 
     SECTION("operator()() const") {
@@ -155,6 +164,66 @@ TEMPLATE_LIST_TEST_CASE("DSLBase", "", test_types) {
                           error_t);
     }
 
+    SECTION("multiplication_assignment (scaled)") {
+        // N.b., does error checks before calling the default of
+        // scaled_multiplication_assignment_, which Smooth does not override
+        using error_t = std::runtime_error;
+        auto s        = default_value("");
+        auto sij      = default_value("i,j");
+        auto mik      = value("i,k");
+        auto mkj      = value("k,j");
+
+        // LHS's indices must match rank
+        REQUIRE_THROWS_AS(value.multiplication_assignment("i,j", 2.0, sij, s),
+                          error_t);
+
+        // RHS's indices must match rank
+        REQUIRE_THROWS_AS(value.multiplication_assignment("i,j", 2.0, s, sij),
+                          error_t);
+
+        // An alpha of 1 is just multiplication_assignment
+        object_type rv(default_value);
+        rv.multiplication_assignment("i,j", 1.0, mik, mkj);
+        REQUIRE(rv == value);
+
+        // Otherwise the product is scaled, which Smooth does not implement
+        REQUIRE_THROWS_AS(rv.multiplication_assignment("i,j", 2.0, mik, mkj),
+                          error_t);
+    }
+
+    SECTION("multiplication_accumulation") {
+        // N.b., does error checks before calling the default of
+        // multiplication_accumulation_, which Smooth does not override
+        using error_t = std::runtime_error;
+        auto s        = default_value("");
+        auto sij      = default_value("i,j");
+        auto mik      = value("i,k");
+        auto mkj      = value("k,j");
+
+        // LHS's indices must match rank
+        REQUIRE_THROWS_AS(value.multiplication_accumulation("i,j", sij, s),
+                          error_t);
+
+        // RHS's indices must match rank
+        REQUIRE_THROWS_AS(value.multiplication_accumulation("i,j", s, sij),
+                          error_t);
+
+        // The indices of *this must match its rank
+        REQUIRE_THROWS_AS(value.multiplication_accumulation("i", mik, mkj),
+                          error_t);
+
+        object_type rv(value);
+        rv.multiplication_accumulation("i,j", mik, mkj);
+        REQUIRE(rv == value);
+
+        // The scaled overload does the same error checks
+        REQUIRE_THROWS_AS(
+          value.multiplication_accumulation("i", -1.0, mik, mkj), error_t);
+
+        rv.multiplication_accumulation("i,j", -1.0, mik, mkj);
+        REQUIRE(rv == value);
+    }
+
     SECTION("permute_assignment") {
         // N.b., does error checks before calling permute_assignment_. We assume
         // permute_assignment_ works and focus on the error checks
@@ -190,4 +259,45 @@ TEMPLATE_LIST_TEST_CASE("DSLBase", "", test_types) {
             REQUIRE_THROWS_AS(value.scalar_multiplication("", 1.0, s), error_t);
         }
     }
+
+    SECTION("linear_combination_assignment") {
+        // N.b., does error checks before calling the pairwise default of
+        // linear_combination_assignment_, which Smooth does not override
+        using error_t = std::runtime_error;
+        using terms_t = typename object_type::linear_terms_type;
+        auto sij      = default_value("i,j");
+        auto mij      = value("i,j");
+        auto mji      = value("j,i");
+        auto mik      = value("i,k");
+
+        // Must have at least one term
+        REQUIRE_THROWS_AS(value.linear_combination_assignment("i,j", terms_t{}),
+                          error_t);
+
+        // Term's indices must match rank
+        terms_t bad_rank{{1.0, sij}};
+        REQUIRE_THROWS_AS(value.linear_combination_assignment("i,j", bad_rank),
+                          error_t);
+
+        // Terms must be related to the output by a permutation
+        terms_t bad_labels{{1.0, mij}, {1.0, mik}};
+        REQUIRE_THROWS_AS(
+          value.linear_combination_assignment("i,j", bad_labels), error_t);
+
+        terms_t terms{{1.0, mij}, {-1.0, mji}, {1.0, mij}};
+        object_type rv;
+        rv.linear_combination_assignment("j,i", terms);
+        object_type corr;
+        corr.permute_assignment("j,i", mij);
+        REQUIRE(rv == corr);
+
+        // Terms which are the result are read before it is overwritten
+        object_type rect(testing::smooth_matrix(2, 3));
+        object_type transposed;
+        transposed.permute_assignment("j,i", rect("i,j"));
+        terms_t aliased{{1.0, rect("i,j")}, {1.0, transposed("j,i")}};
+        object_type corr_aliased(rect);
+        transposed.linear_combination_assignment("i,j", aliased);
+        REQUIRE(transposed == corr_aliased);
+    }
 }
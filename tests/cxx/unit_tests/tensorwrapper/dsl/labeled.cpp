@@ -59,6 +59,29 @@ TEMPLATE_LIST_TEST_CASE("Labeled", "", test_types) {
             labeled_type labeled2(value, "i,j");
             REQUIRE(&labeled2.object() == &value);
             REQUIRE(labeled2.labels() == ij);
+
+            // Taking an rvalue object
+            labeled_type labeled3(std::move(value), ij);
+            REQUIRE(&labeled3.object() == &value);
+            REQUIRE(labeled3.labels() == ij);
+            REQUIRE(labeled3.is_expiring());
+        }
+
+        SECTION("Owning") {
+            auto pvalue = std::make_shared<const object_type>(value);
+            const std::weak_ptr<const object_type> wvalue(pvalue);
+            const auto* pobject = pvalue.get();
+            {
+                const_labeled_type owning(std::move(pvalue), ij);
+                REQUIRE(&owning.object() == pobject);
+                REQUIRE(owning.labels() == ij);
+
+                // Copies share ownership of the object
+                const_labeled_type copy(owning);
+                REQUIRE(&copy.object() == pobject);
+                REQUIRE_FALSE(wvalue.expired());
+            }
+            REQUIRE(wvalue.expired());
         }
 
         SECTION("mutable to const conversion") {
@@ -93,6 +116,28 @@ TEMPLATE_LIST_TEST_CASE("Labeled", "", test_types) {
         REQUIRE(other.labels() == "i,j");
     }
 
+    SECTION("operator+=") {
+        object_type other(value);
+        labeled_type lother(other, "i,j");
+        auto pother = &(lother += labeled_value * labeled_value);
+        REQUIRE(pother == &lother);
+        REQUIRE(other.are_equal(value));
+    }
+
+    SECTION("operator-=") {
+        object_type other(value);
+        labeled_type lother(other, "i,j");
+        auto pother = &(lother -= labeled_value);
+        REQUIRE(pother == &lother);
+        REQUIRE(other.are_equal(value));
+    }
+
+    SECTION("operator*=") {
+        // N.b. Smooth does not implement scalar_multiplication
+        labeled_type lother(value, "i,j");
+        REQUIRE_THROWS_AS(lother *= 2.0, std::runtime_error);
+    }
+
     SECTION("object()") {
         REQUIRE(labeled_default.object().are_equal(defaulted));
         REQUIRE(clabeled_default.object().are_equal(defaulted));
@@ -121,6 +166,19 @@ TEMPLATE_LIST_TEST_CASE("Labeled", "", test_types) {
         REQUIRE(std::as_const(clabeled_value).labels() == ij);
     }
 
+    SECTION("is_expiring") {
+        REQUIRE_FALSE(labeled_default.is_expiring());
+        REQUIRE_FALSE(clabeled_value.is_expiring());
+
+        labeled_type expiring(std::move(value), ij);
+        REQUIRE(expiring.is_expiring());
+        REQUIRE(labeled_type(expiring).is_expiring());
+
+        // Read-only objects can not be reused
+        REQUIRE_FALSE(const_labeled_type(std::move(value), ij).is_expiring());
+        REQUIRE_FALSE(const_labeled_type(expiring).is_expiring());
+    }
+
     SECTION("operator==") {
         // Same values and const-ness
         REQUIRE(labeled_default == labeled_type(defaulted, scalar));
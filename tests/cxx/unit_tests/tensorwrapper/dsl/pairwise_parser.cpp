@@ -22,11 +22,13 @@ TEMPLATE_LIST_TEST_CASE("PairwiseParser", "", testing::dsl_types) {
 
     auto scalar_values = testing::scalar_values();
     auto vector_values = testing::vector_values();
-    auto matrix_values = testing::matrix_values();
+    auto matrix_values  = testing::matrix_values();
+    auto tensor3_values = testing::tensor3_values();
 
     auto value0 = std::get<object_type>(scalar_values);
     auto value1 = std::get<object_type>(vector_values);
     auto value2 = std::get<object_type>(matrix_values);
+    auto value3 = std::get<object_type>(tensor3_values);
 
     dsl::PairwiseParser p;
 
@@ -46,6 +48,14 @@ TEMPLATE_LIST_TEST_CASE("PairwiseParser", "", testing::dsl_types) {
         }
     }
 
+    SECTION("trace") {
+        object_type rv(value1);
+        object_type corr(value1);
+        p.dispatch(rv("i"), value3("i,j,j"));
+        corr.permute_assignment("i", value3("i,j,j"));
+        REQUIRE(corr.are_equal(rv));
+    }
+
     SECTION("addition") {
         object_type rv(value1);
         object_type corr(value1);
@@ -78,6 +88,28 @@ TEMPLATE_LIST_TEST_CASE("PairwiseParser", "", testing::dsl_types) {
         }
     }
 
+    SECTION("linear combination") {
+        object_type rv(value1);
+        object_type corr(value1);
+        object_type temp(value1);
+        p.dispatch(rv("i,j"), value2("i,j") + value2("j,i") - value2("i,j"));
+        temp.addition_assignment("i,j", value2("i,j"), value2("j,i"));
+        corr.subtraction_assignment("i,j", temp("i,j"), value2("i,j"));
+        REQUIRE(corr.are_equal(rv));
+    }
+
+    SECTION("linear combination with traces") {
+        object_type rv(value1);
+        object_type corr(value1);
+        object_type temp0(value1);
+        object_type temp1(value1);
+        p.dispatch(rv("i"), value3("i,j,j") + value2("i,i"));
+        temp0.permute_assignment("i", value3("i,j,j"));
+        temp1.permute_assignment("i", value2("i,i"));
+        corr.addition_assignment("i", temp0("i"), temp1("i"));
+        REQUIRE(corr.are_equal(rv));
+    }
+
     SECTION("multiplication") {
         object_type rv(value1);
         object_type corr(value1);
@@ -92,6 +124,135 @@ TEMPLATE_LIST_TEST_CASE("PairwiseParser", "", testing::dsl_types) {
             corr.multiplication_assignment("i,j", value2("i,j"), value2("i,j"));
             REQUIRE(corr.are_equal(rv));
         }
+
+        SECTION("contraction") {
+            p.dispatch(rv("i,j"), value2("i,k") * value2("k,j"));
+            corr.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("operand is also the result") {
+            object_type lhs(value2);
+            p.dispatch(lhs("i,j"), lhs("i,k") * value2("k,j"));
+            corr.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+            REQUIRE(corr.are_equal(lhs));
+        }
+
+        SECTION("operand is an expression") {
+            object_type temp(value1);
+            auto sum = value2("i,j") + value2("j,i");
+            p.dispatch(rv("i,j"), sum * value2("i,j"));
+            temp.addition_assignment("i,j", value2("i,j"), value2("j,i"));
+            corr.multiplication_assignment("i,j", temp("i,j"), value2("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("scaled") {
+            auto product = 2.0 * value2("i,k") * value2("k,j");
+            if constexpr(std::is_same_v<TestType, Tensor>) {
+                p.dispatch(rv("i,j"), product);
+                corr.multiplication_assignment("i,j", value2("i,k"),
+                                               value2("k,j"));
+                corr.scalar_multiplication("i,j", 2.0, corr("i,j"));
+                REQUIRE(corr.are_equal(rv));
+            } else {
+                // N.b., only tensor and buffer implement scaling
+                using error_t = std::runtime_error;
+                REQUIRE_THROWS_AS(p.dispatch(rv("i,j"), product), error_t);
+            }
+        }
+    }
+
+    SECTION("products in a linear combination") {
+        object_type rv(value1);
+        object_type corr(value1);
+        object_type temp(value1);
+        temp.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+
+        SECTION("sum with a product") {
+            auto product = value2("i,k") * value2("k,j");
+            p.dispatch(rv("i,j"), value2("i,j") + product);
+            corr.addition_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("only products") {
+            auto product = value2("i,k") * value2("k,j");
+            p.dispatch(rv("i,j"), product - product);
+            corr.subtraction_assignment("i,j", temp("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("product involving the result") {
+            object_type lhs(value2);
+            p.dispatch(lhs("i,j"), lhs("i,j") + lhs("i,k") * value2("k,j"));
+            corr.addition_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(lhs));
+        }
+    }
+
+    SECTION("accumulate") {
+        object_type rv(value2);
+        object_type corr(value2);
+        object_type temp(value2);
+
+        SECTION("product") {
+            p.accumulate(rv("i,j"), 1.0, value2("i,k") * value2("k,j"));
+            temp.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+            corr.addition_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("subtract a product") {
+            p.accumulate(rv("i,j"), -1.0, value2("i,k") * value2("k,j"));
+            temp.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+            corr.subtraction_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("product involving the result") {
+            p.accumulate(rv("i,j"), 1.0, rv("i,k") * value2("k,j"));
+            temp.multiplication_assignment("i,j", value2("i,k"), value2("k,j"));
+            corr.addition_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+
+        SECTION("scaled product") {
+            auto product = value2("i,k") * value2("k,j") * 2.0;
+            if constexpr(std::is_same_v<TestType, Tensor>) {
+                p.accumulate(rv("i,j"), -1.0, product);
+                temp.multiplication_assignment("i,j", 2.0, value2("i,k"),
+                                               value2("k,j"));
+                corr.subtraction_assignment("i,j", value2("i,j"), temp("i,j"));
+                REQUIRE(corr.are_equal(rv));
+            } else {
+                // N.b., the default accumulation scales the product
+                using error_t = std::runtime_error;
+                REQUIRE_THROWS_AS(p.accumulate(rv("i,j"), -1.0, product),
+                                  error_t);
+            }
+        }
+
+        SECTION("linear") {
+            p.accumulate(rv("i,j"), 1.0, value2("j,i") - value2("i,j"));
+            temp.subtraction_assignment("i,j", value2("j,i"), value2("i,j"));
+            corr.addition_assignment("i,j", value2("i,j"), temp("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        }
+    }
+
+    SECTION("scale") {
+        if constexpr(std::is_same_v<TestType, Tensor>) {
+            object_type rv(value2);
+            object_type corr(value2);
+            p.scale(rv("i,j"), 2.0);
+            corr.scalar_multiplication("i,j", 2.0, value2("i,j"));
+            REQUIRE(corr.are_equal(rv));
+        } else {
+            // N.b., only tensor and buffer implement scalar_multiplication
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(p.scale(value2("i,j"), 2.0), error_t);
+        }
     }
 
     SECTION("scalar_multiplication") {
@@ -173,6 +334,14 @@ TEST_CASE("PairwiseParser : buffer::Eigen") {
         }
     }
 
+    SECTION("linear combination") {
+        auto ptemp = testing::eigen_scalar<float>();
+        p.dispatch(scalar0(""), scalar1("") - scalar2("") * 2.0);
+        ptemp->scalar_multiplication("", 2.0, scalar2(""));
+        corr.subtraction_assignment("", scalar1(""), (*ptemp)(""));
+        REQUIRE(corr.are_equal(scalar0));
+    }
+
     SECTION("scalar_multiplication") {
         p.dispatch(scalar0(""), scalar1("") * 1.0);
         corr.scalar_multiplication("", 1.0, scalar1(""));
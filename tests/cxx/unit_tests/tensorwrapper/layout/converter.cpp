@@ -0,0 +1,108 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/layout/converter.hpp>
+#include <tensorwrapper/shape/smooth.hpp>
+#include <tensorwrapper/sparsity/pattern.hpp>
+#include <tensorwrapper/symmetry/permutation.hpp>
+
+using namespace tensorwrapper;
+using namespace layout;
+
+TEST_CASE("Converter") {
+    shape::Smooth matrix_shape{2, 3};
+    symmetry::Permutation p01{1, 0};
+    symmetry::Group symm{p01};
+    sparsity::Pattern no_sparsity(2);
+    Logical logical(matrix_shape, symm, no_sparsity);
+
+    Converter c;
+
+    SECTION("convert") {
+        SECTION("Default") {
+            auto pphys = c.convert(logical);
+            Physical corr(matrix_shape, symm, no_sparsity);
+            REQUIRE(*pphys == corr);
+            REQUIRE(pphys->is_row_major());
+        }
+
+        SECTION("Column-major") {
+            auto pphys = c.convert(logical, StorageOrder::column_major);
+            Physical corr(matrix_shape, symm, no_sparsity,
+                          Physical::stride_vector{1, 2});
+            REQUIRE(*pphys == corr);
+            REQUIRE(pphys->symmetry() == symm);
+        }
+
+        SECTION("Padded") {
+            auto pphys = c.convert(logical, StorageOrder::row_major, 5);
+            REQUIRE(pphys->strides() == Physical::stride_vector{8, 1});
+            REQUIRE(pphys->storage_size() == 11);
+        }
+
+        SECTION("Mode order") {
+            auto pphys = c.convert(logical, Converter::mode_vector{1, 0});
+            REQUIRE(*pphys == *c.convert(logical, StorageOrder::column_major));
+
+            auto prow = c.convert(logical, Converter::mode_vector{0, 1});
+            REQUIRE(prow->is_row_major());
+
+            using except_t = std::runtime_error;
+            using modes_t  = Converter::mode_vector;
+            REQUIRE_THROWS_AS(c.convert(logical, modes_t{0}), except_t);
+            REQUIRE_THROWS_AS(c.convert(logical, modes_t{0, 0}), except_t);
+            REQUIRE_THROWS_AS(c.convert(logical, modes_t{0, 2}), except_t);
+        }
+
+        SECTION("Recorded contractions") {
+            shape::Smooth t_shape{2, 3, 4, 5};
+            Logical t_logical(t_shape);
+            c.record_contraction({1, 3});
+            auto pphys = c.convert(t_logical);
+            using strides_t = Physical::stride_vector;
+            REQUIRE(pphys->strides() == strides_t{60, 5, 15, 1});
+            REQUIRE(pphys->storage_size() == t_shape.size());
+        }
+
+        SECTION("Given mode order") {
+            Converter col_major(Converter::mode_vector{1, 0});
+            col_major.record_contraction({0}); // The given order wins
+            auto pphys = col_major.convert(logical);
+            using strides_t = Physical::stride_vector;
+            REQUIRE(pphys->strides() == strides_t{1, 2});
+
+            Logical vector_logical(shape::Smooth{3});
+            using except_t = std::runtime_error;
+            REQUIRE_THROWS_AS(col_major.convert(vector_logical), except_t);
+        }
+    }
+
+    SECTION("preferred_mode_order") {
+        using modes_t = Converter::mode_vector;
+        REQUIRE(c.preferred_mode_order(3) == modes_t{0, 1, 2});
+
+        c.record_contraction({0});
+        REQUIRE(c.preferred_mode_order(3) == modes_t{1, 2, 0});
+
+        c.record_contraction({2});
+        c.record_contraction({2});
+        REQUIRE(c.preferred_mode_order(3) == modes_t{1, 0, 2});
+
+        // Modes which were never recorded are slowest
+        REQUIRE(c.preferred_mode_order(4) == modes_t{1, 3, 0, 2});
+    }
+}
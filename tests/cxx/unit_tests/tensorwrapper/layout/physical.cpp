@@ -51,6 +51,113 @@ TEST_CASE("Physical") {
             REQUIRE(phys_copy_just_shape.symmetry() == no_symm);
             REQUIRE(phys_copy_just_shape.sparsity() == no_sparsity);
         }
+
+        SECTION("Strides") {
+            Physical strided(matrix_shape, Physical::stride_vector{1, 2});
+            REQUIRE(strided.symmetry() == no_symm);
+            REQUIRE(strided.sparsity() == no_sparsity);
+            REQUIRE(strided.strides() == Physical::stride_vector{1, 2});
+
+            // Row-major strides are the default layout
+            Physical dense(matrix_shape, Physical::stride_vector{3, 1});
+            REQUIRE(dense == phys_copy_just_shape);
+
+            Physical::stride_vector too_few{1};
+            REQUIRE_THROWS_AS(Physical(matrix_shape, too_few),
+                              std::runtime_error);
+
+            // Strides which map two elements to the same place
+            using except_t  = std::invalid_argument;
+            using strides_t = Physical::stride_vector;
+            REQUIRE_THROWS_AS(Physical(matrix_shape, strides_t{0, 1}),
+                              except_t);
+            REQUIRE_THROWS_AS(Physical(matrix_shape, strides_t{3, 0}),
+                              except_t);
+            REQUIRE_THROWS_AS(Physical(matrix_shape, strides_t{2, 1}),
+                              except_t);
+            REQUIRE_THROWS_AS(Physical(matrix_shape, strides_t{1, 1}),
+                              except_t);
+
+            // Padding is fine, as are any strides for modes of extent one
+            Physical padded(matrix_shape, strides_t{4, 1});
+            REQUIRE(padded.storage_size() == 7);
+            shape::Smooth row_shape{1, 3};
+            Physical row(row_shape, strides_t{0, 1});
+            REQUIRE(row.storage_size() == 3);
+        }
+
+        SECTION("StorageOrder") {
+            Physical col(matrix_shape, StorageOrder::column_major);
+            REQUIRE(col.strides() == Physical::stride_vector{1, 2});
+
+            Physical row(matrix_shape, StorageOrder::row_major);
+            REQUIRE(row == phys_copy_just_shape);
+
+            Physical padded(matrix_shape, StorageOrder::row_major, 1);
+            REQUIRE(padded.strides() == Physical::stride_vector{4, 1});
+        }
+    }
+
+    SECTION("make_strides") {
+        using vector_t = Physical::stride_vector;
+        shape::Smooth t{2, 3, 4};
+        auto row_major = StorageOrder::row_major;
+        auto col_major = StorageOrder::column_major;
+        REQUIRE(Physical::make_strides(t, row_major) == vector_t{12, 4, 1});
+        REQUIRE(Physical::make_strides(t, col_major) == vector_t{1, 2, 6});
+        REQUIRE(Physical::make_strides(t, row_major, 4) == vector_t{24, 8, 1});
+        REQUIRE(Physical::make_strides(t, col_major, 2) == vector_t{1, 4, 12});
+
+        shape::Smooth scalar{};
+        REQUIRE(Physical::make_strides(scalar, row_major).empty());
+    }
+
+    SECTION("strides") {
+        using vector_t = Physical::stride_vector;
+        REQUIRE(phys_copy_just_shape.strides() == vector_t{3, 1});
+        REQUIRE(Physical{}.strides().empty());
+    }
+
+    SECTION("is_row_major") {
+        REQUIRE(phys_copy_just_shape.is_row_major());
+        Physical col(matrix_shape, StorageOrder::column_major);
+        REQUIRE_FALSE(col.is_row_major());
+    }
+
+    SECTION("storage_size") {
+        REQUIRE(Physical{}.storage_size() == 0);
+        REQUIRE(phys_copy_just_shape.storage_size() == 6);
+
+        Physical col(matrix_shape, StorageOrder::column_major);
+        REQUIRE(col.storage_size() == 6);
+
+        // Last row has no padding after it
+        Physical padded(matrix_shape, StorageOrder::row_major, 2);
+        REQUIRE(padded.storage_size() == 8);
+
+        shape::Smooth empty{2, 0};
+        Physical empty_col(empty, StorageOrder::column_major);
+        REQUIRE(empty_col.storage_size() == 0);
+    }
+
+    SECTION("operator==") {
+        Physical col(matrix_shape, StorageOrder::column_major);
+        REQUIRE(col == Physical(matrix_shape, StorageOrder::column_major));
+        REQUIRE_FALSE(col == phys_copy_just_shape);
+        REQUIRE(col != phys_copy_just_shape);
+        REQUIRE_FALSE(col.are_equal(phys_copy_just_shape));
+    }
+
+    SECTION("DSL results are row-major") {
+        Physical col(matrix_shape, StorageOrder::column_major);
+        Physical rv(matrix_shape, StorageOrder::column_major);
+        rv("i,j") = col("j,i");
+        REQUIRE(rv.is_row_major());
+
+        Physical rv2(matrix_shape, StorageOrder::column_major);
+        rv2("i,j") = col("i,j") + phys_copy_just_shape("i,j");
+        REQUIRE(rv2.is_row_major());
+        REQUIRE(rv2 == phys_copy_just_shape);
     }
 
     SECTION("Virtual method overrides") {
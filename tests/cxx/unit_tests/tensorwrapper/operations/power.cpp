@@ -42,4 +42,24 @@ TEMPLATE_LIST_TEST_CASE("power", "", types::floating_point_types) {
         auto corr = make_tensor({5}, data.begin(), data.end());
         REQUIRE(approximately_equal(rv, corr));
     }
+
+    SECTION("expiring input") {
+        shape::Smooth s{5};
+        Tensor vector(s, testing::eigen_vector<TestType>());
+        Tensor copy(vector);
+        auto data = [](const Tensor& t) {
+            return buffer::get_raw_data<TestType>(t.buffer()).data();
+        };
+        const auto* pdata = data(vector);
+
+        // The copy shares its elements with vector, so they must be copied
+        auto rv = power(copy, 2);
+        REQUIRE(data(rv) != pdata);
+        REQUIRE(approximately_equal(copy, vector));
+
+        // Once vector is the sole owner, its expiring elements are reused
+        copy = Tensor();
+        rv   = power(std::move(vector), 2);
+        REQUIRE(data(rv) == pdata);
+    }
 }
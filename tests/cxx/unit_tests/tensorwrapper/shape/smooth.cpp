@@ -270,9 +270,39 @@ TEST_CASE("Smooth") {
                 REQUIRE(tensor2 == Smooth{5, 4, 3});
             }
 
-            // Requesting a trace
-            REQUIRE_THROWS_AS(scalar.permute_assignment("", vector("i")),
-                              std::runtime_error);
+            SECTION("assign with trace") {
+                Smooth scalar2{10};
+                auto pscalar2 = &(scalar2.permute_assignment("", vector("i")));
+                REQUIRE(pscalar2 == &scalar2);
+                REQUIRE(scalar2 == scalar);
+
+                Smooth vector2{};
+                auto tijk     = tensor("i,j,k"); // n.b., it's 3 by 4 by 5
+                auto pvector2 = &(vector2.permute_assignment("k", tijk));
+                REQUIRE(pvector2 == &vector2);
+                REQUIRE(vector2 == Smooth{5});
+
+                Smooth matrix2{};
+                auto pmatrix2 = &(matrix2.permute_assignment("k,i", tijk));
+                REQUIRE(pmatrix2 == &matrix2);
+                REQUIRE(matrix2 == Smooth{5, 3});
+
+                Smooth square{3, 3};
+                auto sii      = square("i,i");
+                auto pvector3 = &(vector2.permute_assignment("", sii));
+                REQUIRE(pvector3 == &vector2);
+                REQUIRE(vector2 == scalar);
+            }
+
+            using error_t = std::runtime_error;
+
+            // Traced modes must have the same extent
+            REQUIRE_THROWS_AS(scalar.permute_assignment("", matrix("i,i")),
+                              error_t);
+
+            // Result can't have repeated indices
+            REQUIRE_THROWS_AS(matrix.permute_assignment("i,i", matrix("i,j")),
+                              error_t);
         }
     }
 
@@ -160,5 +160,10 @@ TEST_CASE("Pattern") {
         auto prv = &(rv.permute_assignment("i", p1("i")));
         REQUIRE(prv == &rv);
         REQUIRE(rv == p1);
+
+        // Trace
+        prv = &(rv.permute_assignment("", p2("i,i")));
+        REQUIRE(prv == &rv);
+        REQUIRE(rv == p0);
     }
 }
@@ -280,6 +280,14 @@ TEST_CASE("Group") {
             REQUIRE(empty2 == g2);
         }
 
+        SECTION("Trace") {
+            Group g2(2);
+            auto g2ii    = g2("i,i");
+            auto pempty2 = &(empty2.permute_assignment("", g2ii));
+            REQUIRE(pempty2 == &empty2);
+            REQUIRE(empty2 == Group(0));
+        }
+
         // Throws if non-trivial symmetry
         using error_t = std::runtime_error;
         label_type ijkl("i,j,k,l");
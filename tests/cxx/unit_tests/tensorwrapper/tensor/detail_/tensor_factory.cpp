@@ -86,6 +86,15 @@ TEST_CASE("TensorFactory") {
     SECTION("default_physical_layout") {
         auto result = TensorFactory::default_physical_layout(logical);
         REQUIRE(result->are_equal(physical));
+
+        SECTION("Given a converter") {
+            layout::Logical matrix(shape::Smooth{2, 3});
+            layout::Converter col_major(layout::Converter::mode_vector{1, 0});
+            auto presult =
+              TensorFactory::default_physical_layout(matrix, col_major);
+            using strides_t = layout::Physical::stride_vector;
+            REQUIRE(presult->strides() == strides_t{1, 2});
+        }
     }
 
     SECTION("construct(input)") {
@@ -101,6 +110,16 @@ TEST_CASE("TensorFactory") {
             REQUIRE(&ppimpl->buffer() == buffer_address);
         }
 
+        SECTION("Shape & Converter") {
+            layout::Converter col_major(layout::Converter::mode_vector{1, 0});
+            TensorInput i(shape::Smooth{2, 3}, col_major);
+            auto ppimpl          = TensorFactory::construct(std::move(i));
+            const auto& elements = ppimpl->buffer().layout();
+            using strides_t      = layout::Physical::stride_vector;
+            REQUIRE(elements.strides() == strides_t{1, 2});
+            REQUIRE(elements.shape().are_equal(shape::Smooth{2, 3}));
+        }
+
         SECTION("Throws if invalid") {
             TensorInput i(std::move(pbuffer));
             using except_t = std::runtime_error;
@@ -182,6 +201,11 @@ TEST_CASE("TensorFactory") {
             REQUIRE_THROWS_AS(f.assert_valid(i), e_t);
         }
 
+        SECTION("Converter with a physical layout") {
+            TensorInput i(logical, physical, layout::Converter{});
+            REQUIRE_THROWS_AS(f.assert_valid(i), e_t);
+        }
+
         SECTION("only buffer") {
             TensorInput i(std::move(pbuffer));
             REQUIRE_THROWS_AS(f.assert_valid(i), e_t);
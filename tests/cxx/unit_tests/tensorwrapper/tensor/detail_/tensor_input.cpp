@@ -37,6 +37,7 @@ TEST_CASE("TensorInput") {
     sparsity::Pattern sparsity(2);
     layout::Logical logical(shape, g, sparsity);
     layout::Physical physical(shape, g, sparsity);
+    layout::Converter converter(layout::Converter::mode_vector{1, 0});
 
     std::vector<double> data{42.0};
     auto pbuffer = std::make_unique<buffer::Contiguous>(data, shape::Smooth{});
@@ -201,6 +202,30 @@ TEST_CASE("TensorInput") {
             REQUIRE(i.has_physical_layout());
         }
 
+        SECTION("Converter (by value)") {
+            detail_::TensorInput i(converter, shape);
+            REQUIRE(i.m_pshape->are_equal(shape));
+            REQUIRE(i.m_plogical == nullptr);
+            REQUIRE(i.m_pphysical == nullptr);
+            REQUIRE(i.m_pconverter->preferred_mode_order(2) ==
+                    converter.preferred_mode_order(2));
+            REQUIRE(i.m_pbuffer == nullptr);
+            REQUIRE(i.m_rv == rv);
+            REQUIRE(i.has_converter());
+        }
+
+        SECTION("Converter (by pointer)") {
+            auto pconverter = std::make_unique<layout::Converter>(converter);
+            auto converter_address = pconverter.get();
+            detail_::TensorInput i(std::move(pconverter), shape);
+            REQUIRE(i.m_pshape->are_equal(shape));
+            REQUIRE(i.m_pphysical == nullptr);
+            REQUIRE(i.m_pconverter.get() == converter_address);
+            REQUIRE(i.m_pbuffer == nullptr);
+            REQUIRE(i.m_rv == rv);
+            REQUIRE(i.has_converter());
+        }
+
         SECTION("Buffer (by value)") {
             detail_::TensorInput i(physical, logical, buffer);
             REQUIRE(i.m_pshape == nullptr);
@@ -271,6 +296,13 @@ TEST_CASE("TensorInput") {
         REQUIRE(w_physical.has_physical_layout());
     }
 
+    SECTION("has_converter") {
+        REQUIRE_FALSE(defaulted.has_converter());
+
+        detail_::TensorInput w_converter(converter);
+        REQUIRE(w_converter.has_converter());
+    }
+
     SECTION("has_buffer") {
         REQUIRE_FALSE(defaulted.has_buffer());
 
@@ -58,6 +58,12 @@ TEST_CASE("TensorPIMPL") {
     SECTION("clone") {
         auto pvalue_copy = value.clone();
         REQUIRE(*pvalue_copy == value);
+
+        // The copy shares the elements of value
+        const auto& cvalue = value;
+        const auto& ccopy  = *pvalue_copy;
+        auto pdata = buffer::get_raw_data<double>(cvalue.buffer()).data();
+        REQUIRE(buffer::get_raw_data<double>(ccopy.buffer()).data() == pdata);
     }
 
     SECTION("logical_layout()") {
@@ -76,6 +82,17 @@ TEST_CASE("TensorPIMPL") {
         REQUIRE(const_value.buffer().are_equal(*pbuffer_corr));
     }
 
+    SECTION("set_logical_layout") {
+        shape::Smooth scalar{};
+        layout::Logical scalar_logical(scalar);
+        value.set_logical_layout(scalar_logical.clone_as<layout::Logical>());
+        REQUIRE(value.logical_layout().are_equal(scalar_logical));
+        REQUIRE(&value.buffer() == buffer_address);
+
+        using except_t = std::runtime_error;
+        REQUIRE_THROWS_AS(value.set_logical_layout(nullptr), except_t);
+    }
+
     SECTION("operator==") {
         auto plogical2 = logical_corr.clone_as<layout::Logical>();
         auto pbuffer2  = pbuffer_corr->clone();
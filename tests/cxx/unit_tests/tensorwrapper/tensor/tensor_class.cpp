@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #include "../testing/testing.hpp"
+#include <tensorwrapper/backends/plan_cache_stats.hpp>
+#include <tensorwrapper/layout/converter.hpp>
 #include <tensorwrapper/tensor/detail_/tensor_factory.hpp>
 #include <tensorwrapper/tensor/detail_/tensor_pimpl.hpp>
 #include <tensorwrapper/tensor/tensor_class.hpp>
@@ -238,6 +240,57 @@ TEST_CASE("Tensor") {
             REQUIRE(poutput == &output);
             REQUIRE(corr == output);
         }
+
+        SECTION("bij,bjk->bik") {
+            Tensor output;
+
+            Tensor tensor(testing::smooth_tensor3_<double>());
+
+            auto lhs = tensor("b,i,j");
+            auto rhs = tensor("b,j,k");
+
+            auto poutput =
+              &(output.multiplication_assignment("b,i,k", lhs, rhs));
+
+            Tensor corr{{{7.0, 10.0}, {15.0, 22.0}},
+                        {{67.0, 78.0}, {91.0, 106.0}}};
+
+            REQUIRE(poutput == &output);
+            REQUIRE(corr == output);
+        }
+
+        SECTION("ik,jj->i") {
+            Tensor output;
+            Tensor m0{{1.0, 2.0}, {3.0, 4.0}};
+
+            auto poutput =
+              &(output.multiplication_assignment("i", m0("i,k"), m0("j,j")));
+
+            REQUIRE(poutput == &output);
+            REQUIRE(output == Tensor{15.0, 35.0});
+        }
+
+        SECTION("Operand with its modes stored in another order") {
+            // Stores {{1, 2}, {3, 4}} column-major
+            layout::Converter col_major(layout::Converter::mode_vector{1, 0});
+            Tensor m0(shape::Smooth{2, 2}, col_major);
+            auto& m0_buffer = buffer::make_contiguous(m0.buffer());
+            using strides_t = layout::Physical::stride_vector;
+            REQUIRE(m0_buffer.layout().strides() == strides_t{1, 2});
+            m0_buffer.set_elem({0, 0}, 1.0);
+            m0_buffer.set_elem({0, 1}, 2.0);
+            m0_buffer.set_elem({1, 0}, 3.0);
+            m0_buffer.set_elem({1, 1}, 4.0);
+            Tensor m1{{1.0, 2.0}, {3.0, 4.0}};
+
+            // The GEMM path goes through the backend's plan cache, the strided
+            // path (used for other strides) does not
+            backends::clear_plan_cache();
+            Tensor output;
+            output.multiplication_assignment("i,j", m0("i,k"), m1("k,j"));
+            REQUIRE(backends::plan_cache_stats().misses == 1);
+            REQUIRE(output == Tensor{{7.0, 10.0}, {15.0, 22.0}});
+        }
     }
     SECTION("scalar_multiplication") {
         SECTION("scalar") {
@@ -264,6 +317,26 @@ TEST_CASE("Tensor") {
             REQUIRE(rv == corr);
         }
     }
+    SECTION("linear_combination_assignment") {
+        using terms_type = typename Tensor::linear_terms_type;
+        SECTION("scalar") {
+            Tensor rv;
+            Tensor s0(42.0);
+            terms_type terms{{2.0, s0("")}, {-1.0, s0("")}};
+            auto prv = &(rv.linear_combination_assignment("", terms));
+            REQUIRE(prv == &rv);
+            REQUIRE(rv == Tensor(42.0));
+        }
+        SECTION("matrix") {
+            Tensor rv;
+            Tensor m0{{1, 2}, {3, 4}};
+            terms_type terms{{1.0, m0("i,j")}, {2.0, m0("j,i")}};
+            auto prv = &(rv.linear_combination_assignment("j,i", terms));
+            REQUIRE(prv == &rv);
+            Tensor corr{{3.0, 7.0}, {8.0, 12.0}};
+            REQUIRE(rv == corr);
+        }
+    }
     SECTION("permute_assignment") {
         SECTION("scalar") {
             Tensor rv;
@@ -288,5 +361,171 @@ TEST_CASE("Tensor") {
             Tensor corr{{1, 3}, {2, 4}};
             REQUIRE(rv == corr);
         }
+        SECTION("trace") {
+            Tensor rv;
+            Tensor t0(testing::smooth_tensor3_<double>());
+            auto prv = &(rv.permute_assignment("i", t0("i,j,j")));
+            REQUIRE(prv == &rv);
+            REQUIRE(rv == Tensor{5.0, 13.0});
+        }
+        SECTION("trace (DSL)") {
+            Tensor rv;
+            Tensor t0(testing::smooth_tensor3_<double>());
+            rv("i") = t0("i,j,j");
+            REQUIRE(rv == Tensor{5.0, 13.0});
+
+            Tensor v0{1.0, 2.0};
+            rv("i") = t0("i,j,j") + v0("i");
+            REQUIRE(rv == Tensor{6.0, 15.0});
+        }
+    }
+    SECTION("Operations reuse the buffer of the result") {
+        Tensor m0{{1, 2}, {3, 4}};
+        Tensor rv{{0, 0}, {0, 0}};
+        const auto* pbuffer = &rv.buffer();
+
+        SECTION("addition_assignment") {
+            rv.addition_assignment("i,j", m0("i,j"), m0("j,i"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{2, 5}, {5, 8}});
+        }
+        SECTION("subtraction_assignment") {
+            rv.subtraction_assignment("i,j", m0("i,j"), m0("j,i"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{0, -1}, {1, 0}});
+        }
+        SECTION("multiplication_assignment") {
+            rv.multiplication_assignment("i,j", m0("i,k"), m0("k,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{7, 10}, {15, 22}});
+        }
+        SECTION("multiplication_assignment (scaled)") {
+            rv.multiplication_assignment("i,j", 2.0, m0("i,k"), m0("k,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{14, 20}, {30, 44}});
+        }
+        SECTION("scalar_multiplication") {
+            rv.scalar_multiplication("j,i", 2.0, m0("i,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{2, 6}, {4, 8}});
+        }
+        SECTION("permute_assignment") {
+            rv.permute_assignment("j,i", m0("i,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{1, 3}, {2, 4}});
+        }
+        SECTION("linear_combination_assignment") {
+            using terms_type = typename Tensor::linear_terms_type;
+            terms_type terms{{1.0, m0("i,j")}, {-1.0, m0("j,i")}};
+            rv.linear_combination_assignment("i,j", terms);
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{0, -1}, {1, 0}});
+        }
+        SECTION("multiplication_accumulation") {
+            rv.permute_assignment("i,j", m0("i,j"));
+            rv.multiplication_accumulation("i,j", m0("i,k"), m0("k,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{8, 12}, {18, 26}});
+
+            rv.multiplication_accumulation("i,j", -1.0, m0("i,k"), m0("k,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{1, 2}, {3, 4}});
+
+            Tensor m1{{1, 2, 3}, {4, 5, 6}};
+            using except_t = std::runtime_error;
+            REQUIRE_THROWS_AS(
+              rv.multiplication_accumulation("i,j", m0("i,k"), m1("k,j")),
+              except_t);
+        }
+        SECTION("compound assignment") {
+            rv("i,j") += m0("i,k") * m0("k,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{7, 10}, {15, 22}});
+
+            rv("i,j") -= m0("i,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{6, 8}, {12, 18}});
+
+            rv("i,j") *= 0.5;
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{3, 4}, {6, 9}});
+
+            rv("i,j") -= 2.0 * m0("i,k") * m0("k,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{-11, -16}, {-24, -35}});
+        }
+        SECTION("products in an expression") {
+            rv("i,j") = m0("i,j") + 2.0 * m0("i,k") * m0("k,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{15, 22}, {33, 48}});
+
+            rv("i,j") = m0("i,k") * m0("k,j") * 2.0 - m0("i,k") * m0("k,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{7, 10}, {15, 22}});
+        }
+        SECTION("Result has a different shape") {
+            Tensor v0{1, 2, 3};
+            rv.permute_assignment("i", v0("i"));
+            REQUIRE(rv == Tensor{1, 2, 3});
+        }
+        SECTION("Result is also an input") {
+            rv.permute_assignment("i,j", m0("i,j"));
+            rv.permute_assignment("j,i", rv("i,j"));
+            REQUIRE(rv == Tensor{{1, 3}, {2, 4}});
+
+            // The number of elements does not change, so rv is updated in
+            // place
+            REQUIRE(&rv.buffer() == pbuffer);
+            rv.scalar_multiplication("i,j", 2.0, rv("i,j"));
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{2, 6}, {4, 8}});
+
+            rv("i,j") = rv("i,j") * m0("i,j");
+            REQUIRE(&rv.buffer() == pbuffer);
+            REQUIRE(rv == Tensor{{2, 12}, {12, 32}});
+        }
+    }
+
+    SECTION("Expiring operands donate their elements") {
+        Tensor m0{{1, 2}, {3, 4}};
+        Tensor m1{{1, 2}, {3, 4}};
+        Tensor rv;
+        auto data = [](const Tensor& t) {
+            return buffer::get_raw_data<double>(t.buffer()).data();
+        };
+        const auto* pdata = data(m1);
+
+        SECTION("assignment") {
+            rv("i,j") = std::move(m1)("i,j");
+            REQUIRE(data(rv) == pdata);
+            REQUIRE(rv == m0);
+        }
+        SECTION("sum") {
+            rv("i,j") = m0("j,i") + std::move(m1)("i,j");
+            REQUIRE(data(rv) == pdata);
+            REQUIRE(rv == Tensor{{2, 5}, {5, 8}});
+        }
+        SECTION("scalar multiple") {
+            rv("i,j") = 2.0 * std::move(m1)("i,j");
+            REQUIRE(data(rv) == pdata);
+            REQUIRE(rv == Tensor{{2, 4}, {6, 8}});
+        }
+        SECTION("product") {
+            rv("i,j") = std::move(m1)("i,j") * m0("j,i");
+            REQUIRE(data(rv) == pdata);
+            REQUIRE(rv == Tensor{{1, 6}, {6, 16}});
+        }
+        SECTION("Labels differ from the result") {
+            rv("i,j") = std::move(m1)("j,i") + m0("i,j");
+            REQUIRE(data(rv) != pdata);
+            REQUIRE(rv == Tensor{{2, 5}, {5, 8}});
+            REQUIRE(m1 == m0);
+        }
+        SECTION("Operand is read more than once") {
+            rv("i,j") = std::move(m1)("i,j") - m1("j,i");
+            REQUIRE(data(rv) != pdata);
+            REQUIRE(rv == Tensor{{0, -1}, {1, 0}});
+            REQUIRE(m1 == m0);
+        }
     }
 }
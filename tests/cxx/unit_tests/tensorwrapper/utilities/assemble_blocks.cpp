@@ -0,0 +1,84 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../testing/testing.hpp"
+#include <tensorwrapper/utilities/assemble_blocks.hpp>
+
+using namespace tensorwrapper;
+using namespace testing;
+
+using tensorwrapper::utilities::assemble_blocks;
+
+TEMPLATE_LIST_TEST_CASE("assemble_blocks", "", types::floating_point_types) {
+    using block_type  = std::pair<std::vector<std::size_t>, Tensor>;
+    using blocks_type = std::vector<block_type>;
+    using other_float =
+      std::conditional_t<std::is_same_v<TestType, float>, double, float>;
+
+    // Elements 1, 2, 3, 4
+    Tensor matrix(smooth_matrix_<TestType>());
+
+    SECTION("No blocks") { REQUIRE(assemble_blocks({2, 2}, {}) == Tensor()); }
+
+    SECTION("Blocks") {
+        blocks_type blocks{{{0, 0}, matrix}, {{1, 2}, matrix}};
+        auto result = assemble_blocks({3, 4}, blocks);
+
+        shape::Smooth corr_shape{3, 4};
+        auto corr_buffer = buffer::make_contiguous<TestType>(corr_shape);
+        corr_buffer.set_elem({0, 0}, TestType(1.0));
+        corr_buffer.set_elem({0, 1}, TestType(2.0));
+        corr_buffer.set_elem({1, 0}, TestType(3.0));
+        corr_buffer.set_elem({1, 1}, TestType(4.0));
+        corr_buffer.set_elem({1, 2}, TestType(1.0));
+        corr_buffer.set_elem({1, 3}, TestType(2.0));
+        corr_buffer.set_elem({2, 2}, TestType(3.0));
+        corr_buffer.set_elem({2, 3}, TestType(4.0));
+        Tensor corr(corr_shape, std::move(corr_buffer));
+        REQUIRE(result == corr);
+    }
+
+    SECTION("Overlapping blocks") {
+        // Elements 0, 1
+        Tensor vector(shape::Smooth{2}, eigen_vector<TestType>(2));
+        blocks_type blocks{{{0}, vector}, {{1}, vector}};
+        auto result = assemble_blocks({3}, blocks);
+
+        shape::Smooth corr_shape{3};
+        auto corr_buffer = buffer::make_contiguous<TestType>(corr_shape);
+        corr_buffer.set_elem({0}, TestType(0.0));
+        corr_buffer.set_elem({1}, TestType(0.0));
+        corr_buffer.set_elem({2}, TestType(1.0));
+        Tensor corr(corr_shape, std::move(corr_buffer));
+        REQUIRE(result == corr);
+    }
+
+    SECTION("Block does not fit") {
+        blocks_type blocks{{{1, 1}, matrix}};
+        REQUIRE_THROWS_AS(assemble_blocks({2, 2}, blocks), std::out_of_range);
+    }
+
+    SECTION("Block has the wrong rank") {
+        blocks_type blocks{{{0}, matrix}};
+        REQUIRE_THROWS_AS(assemble_blocks({4}, blocks), std::out_of_range);
+    }
+
+    SECTION("Blocks have different floating point types") {
+        Tensor other(smooth_matrix_<other_float>());
+        blocks_type blocks{{{0, 0}, matrix}, {{2, 2}, other}};
+        REQUIRE_THROWS_AS(assemble_blocks({4, 4}, blocks), std::runtime_error);
+    }
+}
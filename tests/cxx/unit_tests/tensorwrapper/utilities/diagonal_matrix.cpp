@@ -30,4 +30,17 @@ TEMPLATE_LIST_TEST_CASE("diagonal_matrix", "", types::floating_point_types) {
       make_tensor({3, 3}, std::vector<TestType>{1, 0, 0, 0, 2, 0, 0, 0, 3});
     auto result = diagonal_matrix(diagonal_values);
     REQUIRE(approximately_equal(result, corr));
+
+    SECTION("Strided diagonal elements") {
+        // Every other element of {1, 9, 2, 9, 3}, e.g., a slice of a NumPy
+        // array
+        shape::Smooth shape{3};
+        layout::Physical strided(shape, layout::Physical::stride_vector{2});
+        std::vector<TestType> storage{1, 9, 2, 9, 3};
+        buffer::Contiguous buffer(buffer::Contiguous::buffer_type(storage),
+                                  strided);
+        Tensor strided_values(shape, std::move(buffer));
+        auto strided_result = diagonal_matrix(strided_values);
+        REQUIRE(approximately_equal(strided_result, corr));
+    }
 }
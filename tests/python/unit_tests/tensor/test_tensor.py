@@ -51,6 +51,19 @@ class TestTensor(unittest.TestCase):
         self.assertFalse((np_vector - vector_corr).any())
         self.assertFalse((np_matrix - matrix_corr).any())
 
+    def test_strided_numpy(self):
+        fortran = tensorwrapper.Tensor(
+            np.asfortranarray([[1.0, 2.0], [3.0, 4.0]]))
+        self.assertTrue(fortran == self.matrix)
+
+        every_other = tensorwrapper.Tensor(
+            np.array([0.0, 9.0, 1.0, 9.0, 2.0, 9.0, 3.0, 9.0, 4.0])[::2])
+        self.assertTrue(every_other == self.vector)
+
+        # Broadcasting maps many elements to the same place
+        with self.assertRaises(ValueError):
+            tensorwrapper.Tensor(np.broadcast_to(np.array([1.0, 2.0]), (2, 2)))
+
     def setUp(self):
         self.defaulted = tensorwrapper.Tensor()
         self.scalar = tensorwrapper.Tensor(np.array(42.0))